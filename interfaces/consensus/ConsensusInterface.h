@@ -47,6 +47,22 @@ public:
         bcos::protocol::BlockNumber _proposalIndex, bcos::crypto::HashType const& _proposalHash,
         std::function<void(Error::Ptr)> _onProposalSubmitted) = 0;
 
+    // submit the proposal by transferring the ownership of the encoded data to the consensus
+    // module, the implementation can hold _proposalData and forward it without copy
+    virtual void asyncSubmitEncodedProposal(bool _containSysTxs, bytesPointer _proposalData,
+        bcos::protocol::BlockNumber _proposalIndex, bcos::crypto::HashType const& _proposalHash,
+        std::function<void(Error::Ptr)> _onProposalSubmitted)
+    {
+        // keep the proposal data alive until the proposal has been submitted
+        asyncSubmitProposal(_containSysTxs, ref(*_proposalData), _proposalIndex, _proposalHash,
+            [_proposalData, _onProposalSubmitted](Error::Ptr _error) {
+                if (_onProposalSubmitted)
+                {
+                    _onProposalSubmitted(_error);
+                }
+            });
+    }
+
     virtual void asyncGetPBFTView(std::function<void(Error::Ptr, ViewType)> _onGetView) = 0;
 
     // the sync module calls this interface to check block
@@ -22,7 +22,9 @@
 #include "../../libutilities/FixedBytes.h"
 #include "CommonType.h"
 #include "KeyInterface.h"
+#include <gsl/span>
 #include <memory>
+#include <tbb/parallel_for.h>
 namespace bcos
 {
 namespace crypto
@@ -54,6 +56,21 @@ public:
     }
     virtual HashType hash(std::string const& _data) { return hash(bytesConstRef(_data)); }
 
+    // hashBatch calculates the hashes of multiple data, the multi-lane implementations should
+    // override it
+    virtual std::vector<HashType> hashBatch(gsl::span<const bytesConstRef> _dataList)
+    {
+        std::vector<HashType> hashes(_dataList.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, _dataList.size()),
+            [&](const tbb::blocked_range<size_t>& _r) {
+                for (auto i = _r.begin(); i < _r.end(); i++)
+                {
+                    hashes[i] = hash(_dataList[i]);
+                }
+            });
+        return hashes;
+    }
+
     template <unsigned N>
     inline HashType hash(FixedBytes<N> const& _input)
     {
@@ -22,7 +22,9 @@
 #include "CommonType.h"
 #include "KeyInterface.h"
 #include "KeyPairInterface.h"
+#include <gsl/span>
 #include <memory>
+#include <tbb/parallel_for.h>
 namespace bcos
 {
 namespace crypto
@@ -46,6 +48,29 @@ public:
     // recover recovers the public key from the given signature
     virtual PublicPtr recover(const HashType& _hash, bytesConstRef _signatureData) = 0;
 
+    // recoverBatch recovers the public keys of multiple signatures, the public key of the invalid
+    // signature is nullptr, the implementations supporting batched recovery should override it
+    virtual std::vector<PublicPtr> recoverBatch(
+        gsl::span<const HashType> _hashes, gsl::span<const bytesConstRef> _signatureDataList)
+    {
+        std::vector<PublicPtr> publicKeys(std::min(_hashes.size(), _signatureDataList.size()));
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, publicKeys.size()),
+            [&](const tbb::blocked_range<size_t>& _r) {
+                for (auto i = _r.begin(); i < _r.end(); i++)
+                {
+                    try
+                    {
+                        publicKeys[i] = recover(_hashes[i], _signatureDataList[i]);
+                    }
+                    catch (std::exception const&)
+                    {
+                        publicKeys[i] = nullptr;
+                    }
+                }
+            });
+        return publicKeys;
+    }
+
     // generateKeyPair generates keyPair
     virtual KeyPairInterface::Ptr generateKeyPair() = 0;
 
@@ -102,6 +102,17 @@ public:
         return receiptsRoot;
     }
 
+    // the merkle leaf of the _index-th transaction or receipt
+    static bytes encodeMerkleLeaf(size_t _index, bcos::crypto::HashType const& _hash)
+    {
+        bcos::codec::scale::ScaleEncoderStream stream;
+        stream.reserve(sizeof(_index) + bcos::crypto::HashType::size);
+        stream << _index;
+        bytes encodedData = stream.take();
+        encodedData.insert(encodedData.end(), _hash.begin(), _hash.end());
+        return encodedData;
+    }
+
     virtual int32_t version() const = 0;
     virtual void setVersion(int32_t _version) = 0;
     virtual BlockType blockType() const = 0;
@@ -164,7 +175,7 @@ public:
     virtual void setNonceList(NonceList&& _nonceList) = 0;
     virtual NonceList const& nonceList() const = 0;
 
-private:
+protected:
     std::vector<bytes> encodeToCalculateRoot(
         size_t _listSize, std::function<bcos::crypto::HashType(size_t _index)> _hashFunc) const
     {
@@ -173,12 +184,7 @@ private:
             tbb::blocked_range<size_t>(0, _listSize), [&](const tbb::blocked_range<size_t>& _r) {
                 for (auto i = _r.begin(); i < _r.end(); ++i)
                 {
-                    bcos::codec::scale::ScaleEncoderStream stream;
-                    stream << i;
-                    bytes encodedData = stream.data();
-                    auto hash = _hashFunc(i);
-                    encodedData.insert(encodedData.end(), hash.begin(), hash.end());
-                    encodedList[i] = std::move(encodedData);
+                    encodedList[i] = encodeMerkleLeaf(i, _hashFunc(i));
                 }
             });
         return encodedList;
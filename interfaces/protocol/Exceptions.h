@@ -26,6 +26,7 @@ namespace protocol
 {
 DERIVE_BCOS_EXCEPTION(InvalidBlockHeader);
 DERIVE_BCOS_EXCEPTION(InvalidSignatureList);
+DERIVE_BCOS_EXCEPTION(InvalidTransaction);
 // transaction exceptions
 DERIVE_BCOS_EXCEPTION(OutOfGasLimit);
 DERIVE_BCOS_EXCEPTION(NotEnoughCash);
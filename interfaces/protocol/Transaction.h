@@ -23,6 +23,7 @@
 #include "../../libutilities/Common.h"
 #include "../../libutilities/Error.h"
 #include "TransactionSubmitResult.h"
+#include <algorithm>
 #include <shared_mutex>
 namespace bcos
 {
@@ -182,5 +183,57 @@ using TransactionsConstPtr = std::shared_ptr<const Transactions>;
 using ConstTransactions = std::vector<Transaction::ConstPtr>;
 using ConstTransactionsPtr = std::shared_ptr<ConstTransactions>;
 
+// verify the transactions in batch with Hash::hashBatch and SignatureCrypto::recoverBatch, and
+// set the senders of the valid ones, returns the indexes of the invalid transactions
+template <typename TransactionList>
+std::vector<size_t> verifyTransactions(
+    bcos::crypto::CryptoSuite::Ptr _cryptoSuite, TransactionList const& _transactions)
+{
+    std::vector<size_t> invalidIndexes;
+    // the transactions have not been verified
+    std::vector<size_t> indexes;
+    std::vector<bytesConstRef> hashFieldsList;
+    for (size_t i = 0; i < _transactions.size(); i++)
+    {
+        if (!_transactions[i]->sender().empty())
+        {
+            continue;
+        }
+        indexes.emplace_back(i);
+        hashFieldsList.emplace_back(_transactions[i]->encode(true));
+    }
+    // check the hash
+    auto hashes = _cryptoSuite->hashImpl()->hashBatch(hashFieldsList);
+    std::vector<size_t> hashCheckedIndexes;
+    std::vector<bcos::crypto::HashType> checkedHashes;
+    std::vector<bytesConstRef> signatureDataList;
+    for (size_t i = 0; i < indexes.size(); i++)
+    {
+        auto const& tx = _transactions[indexes[i]];
+        if (hashes[i] != tx->hash())
+        {
+            invalidIndexes.emplace_back(indexes[i]);
+            continue;
+        }
+        hashCheckedIndexes.emplace_back(indexes[i]);
+        checkedHashes.emplace_back(hashes[i]);
+        signatureDataList.emplace_back(tx->signatureData());
+    }
+    // check the signatures and recover the senders
+    auto publicKeys = _cryptoSuite->signatureImpl()->recoverBatch(checkedHashes, signatureDataList);
+    for (size_t i = 0; i < hashCheckedIndexes.size(); i++)
+    {
+        if (!publicKeys[i])
+        {
+            invalidIndexes.emplace_back(hashCheckedIndexes[i]);
+            continue;
+        }
+        _transactions[hashCheckedIndexes[i]]->forceSender(
+            _cryptoSuite->calculateAddress(publicKeys[i]).asBytes());
+    }
+    std::sort(invalidIndexes.begin(), invalidIndexes.end());
+    return invalidIndexes;
+}
+
 }  // namespace protocol
 }  // namespace bcos
\ No newline at end of file
@@ -0,0 +1,96 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the table from the function selector to the parsed ABI function
+ * @file ABISelectorTable.cpp
+ * @author: yujiechen
+ * @date: 2021-10-18
+ */
+#include "ABISelectorTable.h"
+#include <algorithm>
+#include <random>
+
+using namespace bcos;
+using namespace bcos::codec::abi;
+
+namespace
+{
+// the seeds tried before enlarging the table
+const size_t c_maxSeedTries = 1024;
+}  // namespace
+
+uint32_t ABISelectorTable::selector(const std::string& _signature) const
+{
+    auto hash = m_hashImpl->hash(_signature);
+    return toSelector(hash.data());
+}
+
+bool ABISelectorTable::registerFunction(const std::string& _signature)
+{
+    ABIFunc function;
+    if (!function.parser(_signature))
+    {
+        return false;
+    }
+    // the selector is calculated from the normalized signature
+    auto functionSelector = selector(function.getSignature());
+    if (getFunction(functionSelector))
+    {
+        return false;
+    }
+    m_functions.emplace_back(std::move(function));
+    m_selectors.emplace_back(functionSelector);
+    buildSlots();
+    return true;
+}
+
+void ABISelectorTable::buildSlots()
+{
+    uint32_t bits = 0;
+    while (((size_t)1 << bits) < m_selectors.size())
+    {
+        bits++;
+    }
+    // the fixed random engine to build the same table for the same functions
+    std::mt19937 engine(m_selectors.size());
+    while (true)
+    {
+        m_bits = bits;
+        std::vector<int32_t> slots((size_t)1 << bits, -1);
+        for (size_t i = 0; i < c_maxSeedTries; i++)
+        {
+            // the odd multiplier
+            m_seed = (uint32_t)engine() | 1;
+            std::fill(slots.begin(), slots.end(), -1);
+            bool collision = false;
+            for (size_t index = 0; index < m_selectors.size(); index++)
+            {
+                auto& functionIndex = slots[slot(m_selectors[index])];
+                if (functionIndex >= 0)
+                {
+                    collision = true;
+                    break;
+                }
+                functionIndex = (int32_t)index;
+            }
+            if (!collision)
+            {
+                m_slots = std::move(slots);
+                return;
+            }
+        }
+        bits++;
+    }
+}
@@ -0,0 +1,96 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the table from the function selector to the parsed ABI function
+ * @file ABISelectorTable.h
+ * @author: yujiechen
+ * @date: 2021-10-18
+ */
+#pragma once
+#include "../../interfaces/crypto/Hash.h"
+#include "ContractABIType.h"
+#include <vector>
+
+namespace bcos
+{
+namespace codec
+{
+namespace abi
+{
+// ABISelectorTable parses the function signatures once when the contract is registered, and finds
+// the parsed function of the call data through a perfect hash of the 4-bytes selectors.
+// The table is not thread-safe to register, but can be looked up concurrently afterwards.
+class ABISelectorTable
+{
+public:
+    using Ptr = std::shared_ptr<ABISelectorTable>;
+    explicit ABISelectorTable(bcos::crypto::Hash::Ptr _hashImpl) : m_hashImpl(_hashImpl) {}
+    virtual ~ABISelectorTable() {}
+
+    // register the function signature, e.g. transfer(string,string,uint256)
+    // return false if the signature is invalid, or its selector has been registered
+    virtual bool registerFunction(const std::string& _signature);
+
+    // the parsed function of the selector, nullptr if not registered
+    const ABIFunc* getFunction(uint32_t _selector) const
+    {
+        auto index = m_slots[slot(_selector)];
+        if (index < 0 || m_selectors[index] != _selector)
+        {
+            return nullptr;
+        }
+        return &m_functions[index];
+    }
+    // the parsed function of the call data starting with the selector
+    const ABIFunc* getFunction(bytesConstRef _callData) const
+    {
+        if (_callData.size() < 4)
+        {
+            return nullptr;
+        }
+        return getFunction(toSelector(_callData.data()));
+    }
+
+    size_t size() const { return m_functions.size(); }
+    uint32_t selector(const std::string& _signature) const;
+
+    static uint32_t toSelector(byte const* _data)
+    {
+        return ((uint32_t)_data[0] << 24) | ((uint32_t)_data[1] << 16) |
+               ((uint32_t)_data[2] << 8) | (uint32_t)_data[3];
+    }
+
+private:
+    // the top m_bits bits of the multiplicative hash
+    size_t slot(uint32_t _selector) const
+    {
+        return (size_t)(((uint64_t)(uint32_t)(_selector * m_seed) << m_bits) >> 32);
+    }
+    // find the seed without collision for the registered selectors
+    void buildSlots();
+
+private:
+    bcos::crypto::Hash::Ptr m_hashImpl;
+    std::vector<ABIFunc> m_functions;
+    std::vector<uint32_t> m_selectors;
+
+    // m_slots[slot(selector)] is the index of the function, -1 if empty
+    std::vector<int32_t> m_slots = {-1};
+    uint32_t m_seed = 1;
+    uint32_t m_bits = 0;
+};
+}  // namespace abi
+}  // namespace codec
+}  // namespace bcos
@@ -34,67 +34,114 @@ bool ContractABICodec::abiOutByFuncSelector(
 
     for (const std::string& type : _allTypes)
     {
+        auto elementaryType = ABI_ELEMENTARY_TYPE::INVALID;
         if ("int" == type || "int256" == type)
         {
-            s256 s;
-            deserialize(s, offset);
-            _out.push_back(toString(s));
+            elementaryType = ABI_ELEMENTARY_TYPE::INT;
         }
         else if ("uint" == type || "uint256" == type)
         {
-            u256 u;
-            deserialize(u, offset);
-            _out.push_back(toString(u));
+            elementaryType = ABI_ELEMENTARY_TYPE::UINT;
         }
         else if ("address" == type)
         {
-            Address addr;
-            deserialize(addr, offset);
-            _out.push_back(addr.hex());
+            elementaryType = ABI_ELEMENTARY_TYPE::ADDR;
         }
         else if ("string" == type)
         {
-            u256 stringOffset;
-            deserialize(stringOffset, offset);
-
-            std::string str;
-            deserialize(str, static_cast<std::size_t>(stringOffset));
-            _out.push_back(str);
+            elementaryType = ABI_ELEMENTARY_TYPE::STRING;
         }
-        else
+        if (!decodeToString(elementaryType, _out))
         {  // unsupport type
             return false;
         }
-
         offset += MAX_BYTE_LENGTH;
     }
 
     return true;
 }
 
+bool ContractABICodec::abiOutByFuncSelector(
+    bytesConstRef _data, const ABIFunc& _func, std::vector<std::string>& _out)
+{
+    data = _data;
+    auto const& allTypes = _func.getParamsABIType();
+    if (!allTypes.empty())
+    {
+        validOffset(_func.getParamsHeadSize() - 1);
+    }
+
+    for (std::size_t i = 0; i < allTypes.size(); ++i)
+    {
+        offset = _func.getParamsHeadOffset()[i];
+        // unsupport array type
+        if (allTypes[i].rank() > 0 || !decodeToString(allTypes[i].eleType(), _out))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool ContractABICodec::decodeToString(ABI_ELEMENTARY_TYPE _type, std::vector<std::string>& _out)
+{
+    switch (_type)
+    {
+    case ABI_ELEMENTARY_TYPE::INT:
+    {
+        s256 s;
+        deserialize(s, offset);
+        _out.push_back(toString(s));
+        return true;
+    }
+    case ABI_ELEMENTARY_TYPE::UINT:
+    {
+        _out.push_back(toString(decodeWord(offset)));
+        return true;
+    }
+    case ABI_ELEMENTARY_TYPE::ADDR:
+    {
+        Address addr;
+        deserialize(addr, offset);
+        _out.push_back(addr.hex());
+        return true;
+    }
+    case ABI_ELEMENTARY_TYPE::STRING:
+    {
+        auto stringOffset = decodeWord(offset);
+        auto str = decodeBytes(static_cast<std::size_t>(stringOffset));
+        _out.emplace_back((const char*)str.data(), str.size());
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
 // unsigned integer type uint256.
 bytes ContractABICodec::serialise(const int& _in)
 {
-    return serialise((s256)_in);
+    return serialiseElement(_in);
 }
 
 // unsigned integer type uint256.
 bytes ContractABICodec::serialise(const u256& _in)
 {
-    return h256(_in).asBytes();
+    return serialiseElement(_in);
 }
 
 // two’s complement signed integer type int256.
 bytes ContractABICodec::serialise(const s256& _in)
 {
-    return h256(_in.convert_to<u256>()).asBytes();
+    return serialiseElement(_in);
 }
 
 // equivalent to uint8 restricted to the values 0 and 1. For computing the function selector,
 // bool is used
 bytes ContractABICodec::serialise(const bool& _in)
 {
-    return h256(u256(_in ? 1 : 0)).asBytes();
+    return serialiseElement(_in);
 }
 
 // equivalent to uint160, except for the assumed interpretation and language typing. For
@@ -102,41 +149,122 @@ bytes ContractABICodec::serialise(const bool& _in)
 // bool is used.
 bytes ContractABICodec::serialise(const Address& _in)
 {
-    return bytes(12, 0) + _in.asBytes();
+    return serialiseElement(_in);
 }
 
 // binary type of 32 bytes
 bytes ContractABICodec::serialise(const string32& _in)
 {
-    bytes ret(32, 0);
-    bytesConstRef((byte const*)_in.data(), 32).populate(bytesRef(&ret));
-    return ret;
+    return serialiseElement(_in);
 }
 
 bytes ContractABICodec::serialise(const bytes& _in)
 {
-    bytes ret;
-    ret = h256(u256(_in.size())).asBytes();
-    ret.resize(ret.size() + (_in.size() + 31) / MAX_BYTE_LENGTH * MAX_BYTE_LENGTH);
-    bytesConstRef(&_in).populate(bytesRef(&ret).getCroppedData(32));
-    return ret;
+    return serialiseElement(_in);
 }
 
 // dynamic sized unicode string assumed to be UTF-8 encoded.
 bytes ContractABICodec::serialise(const std::string& _in)
 {
-    bytes ret;
-    ret = h256(u256(_in.size())).asBytes();
-    ret.resize(ret.size() + (_in.size() + 31) / MAX_BYTE_LENGTH * MAX_BYTE_LENGTH);
-    bytesConstRef(&_in).populate(bytesRef(&ret).getCroppedData(32));
-    return ret;
+    return serialiseElement(_in);
 }
 
-void ContractABICodec::deserialize(s256& out, std::size_t _offset)
+bytes ContractABICodec::serialise(const std::string_view& _in)
+{
+    return serialiseElement(_in);
+}
+
+bytes ContractABICodec::serialise(const bytesConstRef& _in)
+{
+    return serialiseElement(_in);
+}
+
+bcos::byte* ContractABICodec::encodeTo(const int& _in, bcos::byte* _out)
+{
+    return encodeTo((s256)_in, _out);
+}
+
+bcos::byte* ContractABICodec::encodeTo(const u256& _in, bcos::byte* _out)
+{
+    // the big-endian data is written in place
+    u256ToBigEndian(_in, _out);
+    return _out + MAX_BYTE_LENGTH;
+}
+
+bcos::byte* ContractABICodec::encodeTo(const s256& _in, bcos::byte* _out)
+{
+    return encodeTo(_in.convert_to<u256>(), _out);
+}
+
+bcos::byte* ContractABICodec::encodeTo(const bool& _in, bcos::byte* _out)
+{
+    return encodeTo(u256(_in ? 1 : 0), _out);
+}
+
+bcos::byte* ContractABICodec::encodeTo(const Address& _in, bcos::byte* _out)
+{
+    // left-padded to 32 bytes
+    std::fill(_out, _out + MAX_BYTE_LENGTH - Address::size, 0);
+    std::copy(_in.data(), _in.data() + Address::size, _out + MAX_BYTE_LENGTH - Address::size);
+    return _out + MAX_BYTE_LENGTH;
+}
+
+bcos::byte* ContractABICodec::encodeTo(const string32& _in, bcos::byte* _out)
+{
+    std::copy(_in.begin(), _in.end(), _out);
+    return _out + MAX_BYTE_LENGTH;
+}
+
+bcos::byte* ContractABICodec::encodeTo(const bytes& _in, bcos::byte* _out)
+{
+    return encodeBytesTo(_in.data(), _in.size(), _out);
+}
+
+bcos::byte* ContractABICodec::encodeTo(const std::string& _in, bcos::byte* _out)
+{
+    return encodeBytesTo((bcos::byte const*)_in.data(), _in.size(), _out);
+}
+
+bcos::byte* ContractABICodec::encodeTo(const std::string_view& _in, bcos::byte* _out)
+{
+    return encodeBytesTo((bcos::byte const*)_in.data(), _in.size(), _out);
+}
+
+bcos::byte* ContractABICodec::encodeTo(const bytesConstRef& _in, bcos::byte* _out)
+{
+    return encodeBytesTo(_in.data(), _in.size(), _out);
+}
+
+bcos::byte* ContractABICodec::encodeBytesTo(
+    bcos::byte const* _data, std::size_t _size, bcos::byte* _out)
+{
+    _out = encodeTo(u256(_size), _out);
+    std::copy(_data, _data + _size, _out);
+    // right-padded with zeros to the multiple of 32 bytes
+    auto end = _out + paddedSize(_size);
+    std::fill(_out + _size, end, 0);
+    return end;
+}
+
+u256 ContractABICodec::decodeWord(std::size_t _offset)
 {
     validOffset(_offset + MAX_BYTE_LENGTH - 1);
+    // convert the big-endian bytes in place
+    return u256FromBigEndian(data.data() + _offset, MAX_BYTE_LENGTH);
+}
 
-    u256 u = fromBigEndian<u256>(data.getCroppedData(_offset, MAX_BYTE_LENGTH));
+bytesConstRef ContractABICodec::decodeBytes(std::size_t _offset)
+{
+    u256 len = decodeWord(_offset);
+    // the length larger than the data is invalid, and should not overflow the offset
+    auto length = len > data.size() ? data.size() : static_cast<std::size_t>(len);
+    validOffset(_offset + MAX_BYTE_LENGTH + length - 1);
+    return data.getCroppedData(_offset + MAX_BYTE_LENGTH, length);
+}
+
+void ContractABICodec::deserialize(s256& out, std::size_t _offset)
+{
+    u256 u = decodeWord(_offset);
     if (u > u256("0x8fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"))
     {
         auto r =
@@ -152,17 +280,12 @@ void ContractABICodec::deserialize(s256& out, std::size_t _offset)
 
 void ContractABICodec::deserialize(u256& _out, std::size_t _offset)
 {
-    validOffset(_offset + MAX_BYTE_LENGTH - 1);
-
-    _out = fromBigEndian<u256>(data.getCroppedData(_offset, MAX_BYTE_LENGTH));
+    _out = decodeWord(_offset);
 }
 
 void ContractABICodec::deserialize(bool& _out, std::size_t _offset)
 {
-    validOffset(_offset + MAX_BYTE_LENGTH - 1);
-
-    u256 ret = fromBigEndian<u256>(data.getCroppedData(_offset, MAX_BYTE_LENGTH));
-    _out = ret > 0 ? true : false;
+    _out = decodeWord(_offset) > 0 ? true : false;
 }
 
 void ContractABICodec::deserialize(Address& _out, std::size_t _offset)
@@ -182,19 +305,22 @@ void ContractABICodec::deserialize(string32& _out, std::size_t _offset)
 
 void ContractABICodec::deserialize(std::string& _out, std::size_t _offset)
 {
-    validOffset(_offset + MAX_BYTE_LENGTH - 1);
-
-    u256 len = fromBigEndian<u256>(data.getCroppedData(_offset, MAX_BYTE_LENGTH));
-    validOffset(_offset + MAX_BYTE_LENGTH + (std::size_t)len - 1);
-    auto result = data.getCroppedData(_offset + MAX_BYTE_LENGTH, static_cast<size_t>(len));
+    auto result = decodeBytes(_offset);
     _out.assign((const char*)result.data(), result.size());
 }
 
 void ContractABICodec::deserialize(bytes& _out, std::size_t _offset)
 {
-    validOffset(_offset + MAX_BYTE_LENGTH - 1);
+    _out = decodeBytes(_offset).toBytes();
+}
 
-    u256 len = fromBigEndian<u256>(data.getCroppedData(_offset, MAX_BYTE_LENGTH));
-    validOffset(_offset + MAX_BYTE_LENGTH + (std::size_t)len - 1);
-    _out = data.getCroppedData(_offset + MAX_BYTE_LENGTH, static_cast<size_t>(len)).toBytes();
-}
\ No newline at end of file
+void ContractABICodec::deserialize(std::string_view& _out, std::size_t _offset)
+{
+    auto result = decodeBytes(_offset);
+    _out = std::string_view((const char*)result.data(), result.size());
+}
+
+void ContractABICodec::deserialize(bytesConstRef& _out, std::size_t _offset)
+{
+    _out = decodeBytes(_offset);
+}
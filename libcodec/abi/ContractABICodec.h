@@ -22,7 +22,9 @@
 #include "../../interfaces/crypto/Hash.h"
 #include "../../libutilities/Common.h"
 #include "../../libutilities/DataConvertUtility.h"
+#include "ContractABIType.h"
 #include <boost/algorithm/string.hpp>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -44,6 +46,18 @@ struct ABIElementType<std::string> : std::true_type
 {
 };
 
+// the view of string, decoded without copy
+template <>
+struct ABIElementType<std::string_view> : std::true_type
+{
+};
+
+// the view of bytes, decoded without copy
+template <>
+struct ABIElementType<bytesConstRef> : std::true_type
+{
+};
+
 template <>
 struct ABIElementType<std::uint8_t> : std::true_type
 {
@@ -114,6 +128,17 @@ struct ABIStringType<std::string> : std::true_type
 {
 };
 
+template <>
+struct ABIStringType<std::string_view> : std::true_type
+{
+};
+
+// bytesConstRef has the same encoding as string
+template <>
+struct ABIStringType<bytesConstRef> : std::true_type
+{
+};
+
 // check if type of static array
 template <class T>
 struct ABIStaticArray : std::false_type
@@ -255,6 +280,8 @@ class ContractABICodec
 public:
     explicit ContractABICodec(bcos::crypto::Hash::Ptr _hashImpl) : m_hashImpl(_hashImpl) {}
 
+    // the serialise methods write into a buffer of the exact size, the nested elements
+    // are written in place without temporary bytes
     template <class T>
     bytes serialise(const T& _t)
     {  // unsupport type
@@ -287,6 +314,8 @@ public:
 
     // dynamic sized unicode string assumed to be UTF-8 encoded.
     bytes serialise(const std::string& _in);
+    bytes serialise(const std::string_view& _in);
+    bytes serialise(const bytesConstRef& _in);
 
     // static array
     template <class T, std::size_t N>
@@ -319,6 +348,9 @@ public:
 
     void deserialize(std::string& _out, std::size_t _offset);
     void deserialize(bytes& _out, std::size_t _offset);
+    // the views into the decoded data without copy, valid as long as the data passed to abiOut
+    void deserialize(std::string_view& _out, std::size_t _offset);
+    void deserialize(bytesConstRef& _out, std::size_t _offset);
 
     // static array
     template <class T, std::size_t N>
@@ -335,9 +367,6 @@ private:
     static const int MAX_BYTE_LENGTH = 32;
     // encode or decode offset
     std::size_t offset{0};
-    // encode temp bytes
-    bytes fixed;
-    bytes dynamic;
 
     // decode data
     bytesConstRef data;
@@ -357,6 +386,13 @@ private:
         }
     }
 
+    // the 32 bytes big-endian word at _offset
+    u256 decodeWord(std::size_t _offset);
+    // the length-prefixed byte sequence at _offset
+    bytesConstRef decodeBytes(std::size_t _offset);
+    // decode the argument of the given elementary type at offset into its string representation
+    bool decodeToString(ABI_ELEMENTARY_TYPE _type, std::vector<std::string>& _out);
+
     template <class T>
     std::string toString(const T& _t)
     {
@@ -365,25 +401,120 @@ private:
         return ss.str();
     }
 
-    inline void abiInAux() { return; }
+    // the size of the encoded element, the same as serialise(_t).size()
+    template <class T>
+    std::size_t encodedSize(const T& _t)
+    {  // unsupport type
+        (void)_t;
+        return 0;
+    }
+    std::size_t encodedSize(const int&) { return MAX_BYTE_LENGTH; }
+    std::size_t encodedSize(const u256&) { return MAX_BYTE_LENGTH; }
+    std::size_t encodedSize(const s256&) { return MAX_BYTE_LENGTH; }
+    std::size_t encodedSize(const bool&) { return MAX_BYTE_LENGTH; }
+    std::size_t encodedSize(const Address&) { return MAX_BYTE_LENGTH; }
+    std::size_t encodedSize(const string32&) { return MAX_BYTE_LENGTH; }
+    std::size_t encodedSize(const bytes& _in) { return MAX_BYTE_LENGTH + paddedSize(_in.size()); }
+    std::size_t encodedSize(const std::string& _in)
+    {
+        return MAX_BYTE_LENGTH + paddedSize(_in.size());
+    }
+    std::size_t encodedSize(const std::string_view& _in)
+    {
+        return MAX_BYTE_LENGTH + paddedSize(_in.size());
+    }
+    std::size_t encodedSize(const bytesConstRef& _in)
+    {
+        return MAX_BYTE_LENGTH + paddedSize(_in.size());
+    }
+    template <class T, std::size_t N>
+    std::size_t encodedSize(const std::array<T, N>& _in);
+    template <class T>
+    std::size_t encodedSize(const std::vector<T>& _in);
+    template <class... T>
+    std::size_t encodedSize(const std::tuple<T...>& _in);
+
+    // the size of the element in the head of the enclosing tuple or array
+    template <class T>
+    std::size_t headSize(const T& _t)
+    {
+        return ABIDynamicType<T>::value ? MAX_BYTE_LENGTH : encodedSize(_t);
+    }
+    // the size of the element in the tail of the enclosing tuple or array
+    template <class T>
+    std::size_t tailSize(const T& _t)
+    {
+        return ABIDynamicType<T>::value ? encodedSize(_t) : 0;
+    }
+    static std::size_t paddedSize(std::size_t _size)
+    {
+        return (_size + MAX_BYTE_LENGTH - 1) / MAX_BYTE_LENGTH * MAX_BYTE_LENGTH;
+    }
 
-    template <class T, class... U>
-    void abiInAux(T const& _t, U const&... _u)
+    // write the encoded element to _out, which must hold encodedSize(_t) bytes, return the end of
+    // the written data
+    template <class T>
+    byte* encodeTo(const T& _t, byte* _out)
+    {  // unsupport type
+        (void)_t;
+        static_assert(ABIElementType<T>::value, "ABI not support type.");
+        return _out;
+    }
+    byte* encodeTo(const int& _in, byte* _out);
+    byte* encodeTo(const u256& _in, byte* _out);
+    byte* encodeTo(const s256& _in, byte* _out);
+    byte* encodeTo(const bool& _in, byte* _out);
+    byte* encodeTo(const Address& _in, byte* _out);
+    byte* encodeTo(const string32& _in, byte* _out);
+    byte* encodeTo(const bytes& _in, byte* _out);
+    byte* encodeTo(const std::string& _in, byte* _out);
+    byte* encodeTo(const std::string_view& _in, byte* _out);
+    byte* encodeTo(const bytesConstRef& _in, byte* _out);
+    template <class T, std::size_t N>
+    byte* encodeTo(const std::array<T, N>& _in, byte* _out);
+    template <class T>
+    byte* encodeTo(const std::vector<T>& _in, byte* _out);
+    template <class... T>
+    byte* encodeTo(const std::tuple<T...>& _in, byte* _out);
+    // the length-prefixed and zero-padded byte sequence
+    byte* encodeBytesTo(byte const* _data, std::size_t _size, byte* _out);
+
+    template <class T>
+    bytes serialiseElement(const T& _t)
     {
-        bytes out = serialise(_t);
+        bytes ret(encodedSize(_t));
+        encodeTo(_t, ret.data());
+        return ret;
+    }
+
+    // the size of the static elements and the offsets of the dynamic elements
+    template <class... T>
+    std::size_t encodedHeadSize(const std::tuple<T...>& _in)
+    {
+        return std::apply(
+            [this](auto const&... _items) { return (std::size_t(0) + ... + headSize(_items)); },
+            _in);
+    }
+
+    inline void abiInAux(byte*, byte*&) { return; }
 
+    template <class T, class... U>
+    void abiInAux(byte* _head, byte*& _tail, T const& _t, U const&... _u)
+    {
         if (ABIDynamicType<T>::value)
-        {  // dynamic type
-            dynamic += out;
-            fixed += serialise((u256)offset);
-            offset += out.size();
+        {  // dynamic type, write the offset into the head and the data into the tail
+            encodeTo((u256)offset, _head);
+            _head += MAX_BYTE_LENGTH;
+            auto end = encodeTo(_t, _tail);
+            offset += end - _tail;
+            _tail = end;
         }
         else
         {  // static type
-            fixed += out;
+            _head = encodeTo(_t, _head);
         }
 
-        abiInAux(_u...);
+        abiInAux(_head, _tail, _u...);
     }
 
     void abiOutAux() { return; }
@@ -445,19 +576,26 @@ public:
 
     bool abiOutByFuncSelector(bytesConstRef _data, const std::vector<std::string>& _allTypes,
         std::vector<std::string>& _out);
+    // decode with the parameter types parsed once by _func, without handling the type strings
+    bool abiOutByFuncSelector(
+        bytesConstRef _data, const ABIFunc& _func, std::vector<std::string>& _out);
 
     template <class... T>
     bytes abiIn(const std::string& _sig, T const&... _t)
     {
         offset = Offset<T...>::value * MAX_BYTE_LENGTH;
-        fixed.clear();
-        dynamic.clear();
-
-        abiInAux(_t...);
-
-        return _sig.empty() ?
-                   fixed + dynamic :
-                   m_hashImpl->hash(_sig).ref().getCroppedData(0, 4).toBytes() + fixed + dynamic;
+        auto selectorSize = _sig.empty() ? 0 : 4;
+        // allocate the whole encoded data once and write every element in place
+        bytes encodedData(selectorSize + encodedSize(std::tie(_t...)));
+        if (!_sig.empty())
+        {
+            auto selector = m_hashImpl->hash(_sig);
+            std::copy(selector.data(), selector.data() + selectorSize, encodedData.data());
+        }
+        auto head = encodedData.data() + selectorSize;
+        auto tail = head + encodedHeadSize(std::tie(_t...));
+        abiInAux(head, tail, _t...);
+        return encodedData;
     }
 
     template <class... T>
@@ -471,75 +609,129 @@ public:
 template <class T, std::size_t N>
 bytes ContractABICodec::serialise(const std::array<T, N>& _in)
 {
-    bytes offset_bytes;
-    bytes content;
+    return serialiseElement(_in);
+}
+
+// a variable-length array of elements of the given type.
+template <class T>
+bytes ContractABICodec::serialise(const std::vector<T>& _in)
+{
+    return serialiseElement(_in);
+}
 
-    auto length = N * MAX_BYTE_LENGTH;
+template <class... T>
+bytes ContractABICodec::serialise(const std::tuple<T...>& _in)
+{
+    return serialiseElement(_in);
+}
 
+template <class T, std::size_t N>
+std::size_t ContractABICodec::encodedSize(const std::array<T, N>& _in)
+{
+    std::size_t size = ABIDynamicType<T>::value ? N * MAX_BYTE_LENGTH : 0;
     for (const auto& e : _in)
     {
-        bytes out = serialise(e);
-        content += out;
-        if (ABIDynamicType<T>::value)
-        {  // dynamic
-            offset_bytes += serialise(static_cast<u256>(length));
-            length += out.size();
-        }
+        size += encodedSize(e);
     }
-
-    return offset_bytes + content;
+    return size;
 }
 
-// a variable-length array of elements of the given type.
 template <class T>
-bytes ContractABICodec::serialise(const std::vector<T>& _in)
+std::size_t ContractABICodec::encodedSize(const std::vector<T>& _in)
 {
-    bytes offset_bytes;
-    bytes content;
+    std::size_t size = MAX_BYTE_LENGTH;
+    if (ABIDynamicType<T>::value)
+    {
+        size += _in.size() * MAX_BYTE_LENGTH;
+    }
+    for (const auto& e : _in)
+    {
+        size += encodedSize(e);
+    }
+    return size;
+}
 
-    auto length = _in.size() * MAX_BYTE_LENGTH;
+template <class... T>
+std::size_t ContractABICodec::encodedSize(const std::tuple<T...>& _in)
+{
+    return std::apply(
+        [this](auto const&... _items) {
+            return (std::size_t(0) + ... + (headSize(_items) + tailSize(_items)));
+        },
+        _in);
+}
 
-    offset_bytes += serialise(static_cast<u256>(_in.size()));
-    for (const auto& t : _in)
+// a fixed-length array of elements of the given type.
+template <class T, std::size_t N>
+byte* ContractABICodec::encodeTo(const std::array<T, N>& _in, byte* _out)
+{
+    if (!ABIDynamicType<T>::value)
     {
-        bytes out = serialise(t);
-        content += out;
-        if (ABIDynamicType<T>::value)
-        {  // dynamic
-            offset_bytes += serialise(static_cast<u256>(length));
-            length += out.size();
+        for (const auto& e : _in)
+        {
+            _out = encodeTo(e, _out);
         }
+        return _out;
+    }
+    // the offsets of the elements followed by the elements
+    auto begin = _out;
+    auto content = _out + N * MAX_BYTE_LENGTH;
+    for (const auto& e : _in)
+    {
+        encodeTo(static_cast<u256>(content - begin), _out);
+        _out += MAX_BYTE_LENGTH;
+        content = encodeTo(e, content);
     }
+    return content;
+}
 
-    return offset_bytes + content;
+// a variable-length array of elements of the given type.
+template <class T>
+byte* ContractABICodec::encodeTo(const std::vector<T>& _in, byte* _out)
+{
+    _out = encodeTo(static_cast<u256>(_in.size()), _out);
+    if (!ABIDynamicType<T>::value)
+    {
+        for (const auto& e : _in)
+        {
+            _out = encodeTo(e, _out);
+        }
+        return _out;
+    }
+    // the offsets relative to the first offset, followed by the elements
+    auto begin = _out;
+    auto content = _out + _in.size() * MAX_BYTE_LENGTH;
+    for (const auto& e : _in)
+    {
+        encodeTo(static_cast<u256>(content - begin), _out);
+        _out += MAX_BYTE_LENGTH;
+        content = encodeTo(e, content);
+    }
+    return content;
 }
 
 template <class... T>
-bytes ContractABICodec::serialise(const std::tuple<T...>& _in)
+byte* ContractABICodec::encodeTo(const std::tuple<T...>& _in, byte* _out)
 {
-    bytes offsetBytes;
-    bytes dynamicContent;
-    auto tupleSize = std::tuple_size<typename std::remove_reference<decltype(_in)>::type>::value;
-    auto length = tupleSize * MAX_BYTE_LENGTH;
-
+    auto begin = _out;
+    // the static elements and the offsets of the dynamic elements are in the head
+    auto tail = _out + encodedHeadSize(_in);
     traverseTuple(const_cast<std::tuple<T...>&>(_in), [&](auto& _tupleItem) {
-        bytes out = serialise(_tupleItem);
-
         if (ABIDynamicType<typename std::remove_const<
                 typename std::remove_reference<decltype(_tupleItem)>::type>::type>::value)
         {
             // dynamic
-            dynamicContent += out;
-            offsetBytes += serialise(static_cast<u256>(length));
-            length += out.size();
+            encodeTo(static_cast<u256>(tail - begin), _out);
+            _out += MAX_BYTE_LENGTH;
+            tail = encodeTo(_tupleItem, tail);
         }
         else
         {
             // static
-            offsetBytes += out;
+            _out = encodeTo(_tupleItem, _out);
         }
     });
-    return offsetBytes + dynamicContent;
+    return tail;
 }
 
 template <class T, std::size_t N>
@@ -177,7 +177,7 @@ bool ABIInType::reset(const std::string& _s)
     return true;
 }
 
-bool ABIInType::dynamic()
+bool ABIInType::dynamic() const
 {
     // string or bytes
     if (aet == ABI_ELEMENTARY_TYPE::STRING || aet == ABI_ELEMENTARY_TYPE::BYTES)
@@ -198,6 +198,21 @@ bool ABIInType::dynamic()
     return false;
 }
 
+std::size_t ABIInType::headSize() const
+{
+    // 32 bytes for the offset of the dynamic type, or for every static element
+    std::size_t size = 32;
+    if (dynamic())
+    {
+        return size;
+    }
+    for (auto extent : extents)
+    {
+        size *= extent;
+    }
+    return size;
+}
+
 //
 bool ABIInType::removeExtent()
 {
@@ -258,6 +273,8 @@ bool ABIFunc::parser(const std::string& _sig)
                 return false;
             }
             allParamsType.push_back(at);
+            paramsHeadOffset.push_back(paramsHeadSize);
+            paramsHeadSize += at.headSize();
             continue;
         }
     }
@@ -53,12 +53,19 @@ public:
 
 public:
     // the number of dimensions of T or zero
-    std::size_t rank() { return extents.size(); }
+    std::size_t rank() const { return extents.size(); }
     // obtains the size of an array type along a specified dimension
-    std::size_t extent(std::size_t index) { return index > rank() ? 0 : extents[index - 1]; }
+    std::size_t extent(std::size_t index) const
+    {
+        return index > rank() ? 0 : extents[index - 1];
+    }
     bool removeExtent();
-    bool dynamic();
-    bool valid() { return aet != ABI_ELEMENTARY_TYPE::INVALID; }
+    bool dynamic() const;
+    // the size in the head of the encoded parameters: the offset for the dynamic type, or the
+    // whole data of the static type
+    std::size_t headSize() const;
+    bool valid() const { return aet != ABI_ELEMENTARY_TYPE::INVALID; }
+    ABI_ELEMENTARY_TYPE eleType() const { return aet; }
     std::string getType() const { return strType; }
     std::string getEleType() const { return strEleType; }
 
@@ -80,6 +87,9 @@ private:
     std::string strFuncName;
     std::string strFuncSignature;
     std::vector<ABIInType> allParamsType;
+    // the offset of every parameter in the head of the encoded parameters
+    std::vector<std::size_t> paramsHeadOffset;
+    std::size_t paramsHeadSize{0};
 
 public:
     // parser contract abi function signature, eg: transfer(string,string,uint256)
@@ -87,6 +97,11 @@ public:
 
 public:
     std::vector<std::string> getParamsType() const;
+    // the parsed parameter types, used to decode the parameters without parsing the type strings
+    const std::vector<ABIInType>& getParamsABIType() const { return allParamsType; }
+    const std::vector<std::size_t>& getParamsHeadOffset() const { return paramsHeadOffset; }
+    // the encoded parameters are at least getParamsHeadSize() bytes
+    std::size_t getParamsHeadSize() const { return paramsHeadSize; }
     inline std::string getSignature() const { return strFuncSignature; }
     inline std::string getFuncName() const { return strFuncName; }
 };
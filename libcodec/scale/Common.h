@@ -19,6 +19,7 @@
 #pragma once
 #include "Exceptions.h"
 #include "../../libutilities/Common.h"
+#include <array>
 namespace bcos
 {
 namespace codec
@@ -56,6 +57,60 @@ inline size_t countBytes(CompactInteger v)
     } while ((v >>= 8) != 0);
     return counter;
 }
+// the size of the compact-encoded collection length
+constexpr size_t compactLengthSize(size_t _length)
+{
+    if (_length < EncodingCategoryLimits::kMinUint16)
+    {
+        return 1;
+    }
+    if (_length < EncodingCategoryLimits::kMinUint32)
+    {
+        return 2;
+    }
+    if (_length < EncodingCategoryLimits::kMinBigInteger)
+    {
+        return 4;
+    }
+    size_t bytesCount = 0;
+    do
+    {
+        ++bytesCount;
+    } while ((_length >>= 8) != 0);
+    // the header byte and the value
+    return 1 + bytesCount;
+}
+// the compact-encoded collection length calculated at compile time
+template <size_t N>
+constexpr std::array<uint8_t, compactLengthSize(N)> compactLengthPrefix()
+{
+    std::array<uint8_t, compactLengthSize(N)> prefix{};
+    size_t value = N;
+    size_t offset = 0;
+    if (N < EncodingCategoryLimits::kMinUint16)
+    {
+        value = N << 2u;
+    }
+    else if (N < EncodingCategoryLimits::kMinUint32)
+    {
+        value = (N << 2u) + 1u;
+    }
+    else if (N < EncodingCategoryLimits::kMinBigInteger)
+    {
+        value = (N << 2u) + 2u;
+    }
+    else
+    {
+        // the header stores the number of the value bytes
+        prefix[0] = (uint8_t)((prefix.size() - 1 - 4) * 4 + 3);
+        offset = 1;
+    }
+    for (size_t i = offset; i < prefix.size(); i++)
+    {
+        prefix[i] = (uint8_t)(value >> (8 * (i - offset)));
+    }
+    return prefix;
+}
 // Returns the compact encoded length for the given value.
 template <typename T, typename I = std::decay_t<T>,
     typename = std::enable_if_t<std::is_integral<I>::value>>
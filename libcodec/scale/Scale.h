@@ -19,6 +19,7 @@
 #pragma once
 #include "Common.h"
 #include "ScaleDecoderStream.h"
+#include "ScaleEncodedSize.h"
 #include "ScaleEncoderStream.h"
 #include <boost/system/system_error.hpp>
 #include <boost/throw_exception.hpp>
@@ -41,16 +42,18 @@ template <typename... Args>
 void encode(std::shared_ptr<bytes> _encodeData, Args&&... _args)
 {
     ScaleEncoderStream s;
+    s.reserve(scaleEncodedSize(_args...));
     (s << ... << std::forward<Args>(_args));
-    *_encodeData = s.data();
+    *_encodeData = s.take();
 }
 
 template <typename... Args>
 bytes encode(Args&&... _args)
 {
     ScaleEncoderStream s;
+    s.reserve(scaleEncodedSize(_args...));
     (s << ... << std::forward<Args>(_args));
-    return s.data();
+    return s.take();
 }
 
 /**
@@ -17,11 +17,12 @@
  * @file ScaleDecoderStream.cpp
  */
 #include "ScaleDecoderStream.h"
+#include <limits>
 using namespace bcos;
 using namespace bcos::codec::scale;
 
 ScaleDecoderStream::ScaleDecoderStream(gsl::span<byte const> _span)
-  : m_span(_span), m_currentIterator(m_span.begin()), m_currentIndex(0)
+  : m_span(_span), m_currentIndex(0)
 {}
 
 boost::optional<bool> ScaleDecoderStream::decodeOptionalBool()
@@ -135,12 +136,48 @@ ScaleDecoderStream& ScaleDecoderStream::operator>>(CompactInteger& v)
     return *this;
 }
 
+size_t ScaleDecoderStream::decodeLength()
+{
+    if (!hasMore(1))
+    {
+        BOOST_THROW_EXCEPTION(ScaleDecodeException()
+                              << errinfo_comment("decodeLength exception for NOT_ENOUGH_DATA"));
+    }
+    // the lower two bits of the first byte is the encoding mode
+    switch (m_span[m_currentIndex] & 0b00000011u)
+    {
+    case 0b00u:
+        return nextByte() >> 2u;
+    case 0b01u:
+    {
+        uint16_t value;
+        *this >> value;
+        return value >> 2u;
+    }
+    case 0b10u:
+    {
+        uint32_t value;
+        *this >> value;
+        return value >> 2u;
+    }
+    default:
+    {
+        CompactInteger value;
+        *this >> value;
+        if (value > std::numeric_limits<size_t>::max())
+        {
+            BOOST_THROW_EXCEPTION(ScaleDecodeException() << errinfo_comment(
+                                      "decodeLength exception for TOO_MANY_ITEMS"));
+        }
+        return value.convert_to<size_t>();
+    }
+    }
+}
+
 ScaleDecoderStream& ScaleDecoderStream::operator>>(std::string& v)
 {
-    std::vector<uint8_t> collection;
-    *this >> collection;
-    v.clear();
-    v.append(collection.begin(), collection.end());
+    auto size = decodeLength();
+    v.assign((char const*)nextBytes(size), size);
     return *this;
 }
 
@@ -151,12 +188,7 @@ bool ScaleDecoderStream::hasMore(uint64_t n) const
 
 ScaleDecoderStream& ScaleDecoderStream::operator>>(u256& v)
 {
-    bytes decodedBigEndianData;
-    byte size = 32;
-    decodedBigEndianData.resize(size);
-    decodedBigEndianData.assign(m_currentIterator, m_currentIterator + size);
-    m_currentIterator += size;
-    m_currentIndex += size;
-    v = fromBigEndian<u256>(decodedBigEndianData);
+    // decode from the 32 big-endian bytes in place
+    v = fromBigEndian<u256>(bytesConstRef(nextBytes(32), 32));
     return *this;
 }
\ No newline at end of file
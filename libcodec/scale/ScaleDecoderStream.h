@@ -22,11 +22,15 @@
 #include "../../libutilities/FixedBytes.h"
 #include "Common.h"
 #include "FixedWidthIntegerCodec.h"
+#include "ScaleEncodedSize.h"
+#include <boost/endian/conversion.hpp>
 #include <boost/multiprecision/cpp_int.hpp>
 #include <boost/optional.hpp>
 #include <boost/variant.hpp>
 #include <array>
+#include <cstring>
 #include <gsl/span>
+#include <string_view>
 
 namespace bcos
 {
@@ -147,14 +151,19 @@ public:
             return *this;
         }
         // check byte
-        if constexpr (sizeof(T) == 1u)
+        else if constexpr (sizeof(T) == 1u)
         {
             v = nextByte();
             return *this;
         }
-        // decode any other integer
-        v = decodeInteger<I>(*this);
-        return *this;
+        else
+        {
+            // decode any other integer from little-endian
+            I value;
+            std::memcpy(&value, nextBytes(sizeof(I)), sizeof(I));
+            v = boost::endian::little_to_native(value);
+            return *this;
+        }
     }
 
     /**
@@ -209,16 +218,45 @@ public:
     template <unsigned N>
     ScaleDecoderStream& operator>>(FixedBytes<N>& fixedData)
     {
-        bytes decodedData;
-        *this >> decodedData;
-        if (decodedData.size() < FixedBytes<N>::size)
+        // the data encoded by ScaleEncoderStream starts with the length prefix known at compile
+        // time
+        static constexpr auto c_lengthPrefix = compactLengthPrefix<N>();
+        if (hasMore(c_lengthPrefix.size() + N) &&
+            std::memcmp(m_span.data() + m_currentIndex, c_lengthPrefix.data(),
+                c_lengthPrefix.size()) == 0)
+        {
+            auto data = nextBytes(c_lengthPrefix.size() + N) + c_lengthPrefix.size();
+            fixedData = FixedBytes<N>(data, FixedBytes<N>::ConstructorType::FromPointer);
+            return *this;
+        }
+        auto size = decodeLength();
+        if (size < FixedBytes<N>::size)
         {
             BOOST_THROW_EXCEPTION(ScaleDecodeException() << errinfo_comment(
                                       "exception for invalid FixedBytes, expected size:" +
                                       std::to_string(FixedBytes<N>::size) +
-                                      ", decoded data size:" + std::to_string(decodedData.size())));
+                                      ", decoded data size:" + std::to_string(size)));
         }
-        fixedData = FixedBytes<N>(decodedData.data(), FixedBytes<N>::ConstructorType::FromPointer);
+        fixedData = FixedBytes<N>(nextBytes(size), FixedBytes<N>::ConstructorType::FromPointer);
+        return *this;
+    }
+
+    /**
+     * @brief decodes the byte collection as a view into the decoded span without copy,
+     * the view is valid as long as the span
+     * @param v reference to the view
+     * @return reference to stream
+     */
+    ScaleDecoderStream& operator>>(bytesConstRef& v)
+    {
+        auto size = decodeLength();
+        v = bytesConstRef(nextBytes(size), size);
+        return *this;
+    }
+    ScaleDecoderStream& operator>>(std::string_view& v)
+    {
+        auto size = decodeLength();
+        v = std::string_view((char const*)nextBytes(size), size);
         return *this;
     }
     /**
@@ -235,36 +273,52 @@ public:
 
         static_assert(std::is_default_constructible_v<mutableT>);
 
-        CompactInteger size{0u};
-        *this >> size;
-
-        auto item_count = size.convert_to<size_type>();
-        std::vector<mutableT> vec;
-        try
-        {
-            vec.resize(item_count);
-        }
-        catch (const std::bad_alloc&)
-        {
-            BOOST_THROW_EXCEPTION(
-                ScaleDecodeException()
-                << errinfo_comment("exception for TOO_MANY_ITEMS: " + std::to_string(item_count)));
-        }
-        if constexpr (sizeof(T) == 1u)
+        auto item_count = decodeLength();
+        if constexpr (isBulkDecodable<T>())
         {
-            vec.assign(m_currentIterator, m_currentIterator + item_count);
-            m_currentIterator += item_count;
-            m_currentIndex += item_count;
+            // check the size before allocating
+            if (item_count > (m_span.size() - m_currentIndex) / sizeof(T))
+            {
+                BOOST_THROW_EXCEPTION(ScaleDecodeException() << errinfo_comment(
+                                          "exception for NOT_ENOUGH_DATA, items: " +
+                                          std::to_string(item_count)));
+            }
+            auto data = nextBytes(item_count * sizeof(T));
+            v.resize(item_count);
+            std::memcpy(v.data(), data, item_count * sizeof(T));
+            return *this;
         }
         else
         {
+            // the static-size items can be checked before allocating
+            constexpr auto itemSize = ScaleStaticSize<mutableT>::value;
+            if constexpr (itemSize > 0)
+            {
+                if (item_count > (m_span.size() - m_currentIndex) / itemSize)
+                {
+                    BOOST_THROW_EXCEPTION(ScaleDecodeException() << errinfo_comment(
+                                              "exception for NOT_ENOUGH_DATA, items: " +
+                                              std::to_string(item_count)));
+                }
+            }
+            std::vector<mutableT> vec;
+            try
+            {
+                vec.resize(item_count);
+            }
+            catch (const std::bad_alloc&)
+            {
+                BOOST_THROW_EXCEPTION(ScaleDecodeException() << errinfo_comment(
+                                          "exception for TOO_MANY_ITEMS: " +
+                                          std::to_string(item_count)));
+            }
             for (size_type i = 0u; i < item_count; ++i)
             {
                 *this >> vec[i];
             }
+            v = std::move(vec);
+            return *this;
         }
-        v = std::move(vec);
-        return *this;
     }
 
     /**
@@ -349,6 +403,11 @@ public:
     ScaleDecoderStream& operator>>(std::array<T, size>& a)
     {
         using mutableT = std::remove_const_t<T>;
+        if constexpr (isBulkDecodable<T>())
+        {
+            std::memcpy((void*)a.data(), nextBytes(size * sizeof(T)), size * sizeof(T));
+            return *this;
+        }
         for (size_t i = 0u; i < size; ++i)
         {
             *this >> const_cast<mutableT&>(a[i]);  // NOLINT
@@ -382,8 +441,24 @@ public:
             BOOST_THROW_EXCEPTION(ScaleDecodeException()
                                   << errinfo_comment("nextByte exception for NOT_ENOUGH_DATA"));
         }
-        ++m_currentIndex;
-        return *m_currentIterator++;
+        return m_span.data()[m_currentIndex++];
+    }
+
+    /**
+     * @brief takes _size bytes from stream and advances the current index by _size
+     * @return the pointer to the taken bytes in the decoded span
+     */
+    byte const* nextBytes(size_t _size)
+    {
+        if (!hasMore(_size))
+        {
+            BOOST_THROW_EXCEPTION(
+                ScaleDecodeException() << errinfo_comment(
+                    "nextBytes exception for NOT_ENOUGH_DATA, size: " + std::to_string(_size)));
+        }
+        auto data = m_span.data() + m_currentIndex;
+        m_currentIndex += _size;
+        return data;
     }
     using SizeType = gsl::span<const byte>::size_type;
 
@@ -392,6 +467,18 @@ public:
 
 private:
     bool decodeBool();
+    // decodes the compact-encoded collection size without CompactInteger in most cases
+    size_t decodeLength();
+
+    // the items whose memory representation is the same as their scale encoding
+    template <class T>
+    static constexpr bool isBulkDecodable()
+    {
+        using I = std::remove_cv_t<T>;
+        return std::is_integral_v<I> && !std::is_same_v<I, bool> &&
+               (sizeof(I) == 1 || boost::endian::order::native == boost::endian::order::little);
+    }
+
     /**
      * @brief special case of optional values as described in specification
      * @return boost::optional<bool> value
@@ -429,7 +516,6 @@ private:
 
 private:
     gsl::span<byte const> m_span;
-    gsl::span<byte const>::const_iterator m_currentIterator;
     SizeType m_currentIndex;
 };
 }  // namespace scale
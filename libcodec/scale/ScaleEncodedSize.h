@@ -0,0 +1,293 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief calculate the scale-encoded size without encoding
+ * @file ScaleEncodedSize.h
+ * @author: yujiechen
+ * @date: 2021-10-18
+ */
+#pragma once
+#include "../../libutilities/FixedBytes.h"
+#include "Common.h"
+#include <boost/optional.hpp>
+#include <boost/variant.hpp>
+#include <array>
+#include <gsl/span>
+#include <list>
+#include <map>
+#include <memory>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace bcos
+{
+namespace codec
+{
+namespace scale
+{
+/**
+ * @brief the scale-encoded size of the type known at compile time, 0 if it depends on the value
+ * @tparam T the encoded type
+ */
+template <class T, class = void>
+struct ScaleStaticSize
+{
+    static constexpr size_t value = 0;
+};
+
+template <class T>
+struct ScaleStaticSize<T, std::enable_if_t<std::is_integral_v<T>>>
+{
+    static constexpr size_t value = std::is_same_v<T, bool> ? 1 : sizeof(T);
+};
+
+template <>
+struct ScaleStaticSize<u256>
+{
+    static constexpr size_t value = 32;
+};
+
+template <>
+struct ScaleStaticSize<s256>
+{
+    static constexpr size_t value = 32;
+};
+
+template <unsigned N>
+struct ScaleStaticSize<FixedBytes<N>>
+{
+    static constexpr size_t value = compactLengthSize(N) + N;
+};
+
+template <class T, size_t N>
+struct ScaleStaticSize<std::array<T, N>>
+{
+    static constexpr size_t value = N * ScaleStaticSize<T>::value;
+};
+
+template <class... Ts>
+struct ScaleStaticSize<std::tuple<Ts...>>
+{
+    static constexpr size_t value = ((ScaleStaticSize<std::remove_cv_t<Ts>>::value > 0) && ...) ?
+                                        (ScaleStaticSize<std::remove_cv_t<Ts>>::value + ... + 0) :
+                                        0;
+};
+
+template <class F, class S>
+struct ScaleStaticSize<std::pair<F, S>> : ScaleStaticSize<std::tuple<F, S>>
+{
+};
+
+/**
+ * @brief ScaleSizeCounter accepts the same values as ScaleEncoderStream, but only accumulates
+ * the size of the encoded data, the types defining the operator<< template for the encoder
+ * streams are supported as well
+ */
+class ScaleSizeCounter
+{
+public:
+    // special tag to be accepted by the operator<< templates of the encodable types
+    static constexpr auto is_encoder_stream = true;
+
+    size_t size() const { return m_size; }
+
+    template <class F, class S>
+    ScaleSizeCounter& operator<<(const std::pair<F, S>& p)
+    {
+        return *this << p.first << p.second;
+    }
+
+    template <class... Ts>
+    ScaleSizeCounter& operator<<(const std::tuple<Ts...>& v)
+    {
+        std::apply([this](auto const&... _items) { (*this << ... << _items); }, v);
+        return *this;
+    }
+
+    template <class... T>
+    ScaleSizeCounter& operator<<(const boost::variant<T...>& v)
+    {
+        // the type index and the value
+        m_size += 1;
+        boost::apply_visitor([this](auto const& _value) { *this << _value; }, v);
+        return *this;
+    }
+
+    template <class T>
+    ScaleSizeCounter& operator<<(const std::shared_ptr<T>& v)
+    {
+        if (v == nullptr)
+        {
+            BOOST_THROW_EXCEPTION(ScaleEncodeException()
+                                  << errinfo_comment("encode exception for DEREF_NULLPOINTER"));
+        }
+        return *this << *v;
+    }
+
+    template <class T>
+    ScaleSizeCounter& operator<<(const std::unique_ptr<T>& v)
+    {
+        if (v == nullptr)
+        {
+            BOOST_THROW_EXCEPTION(ScaleEncodeException()
+                                  << errinfo_comment("encode exception for DEREF_NULLPOINTER"));
+        }
+        return *this << *v;
+    }
+
+    template <unsigned N>
+    ScaleSizeCounter& operator<<(const FixedBytes<N>&)
+    {
+        m_size += ScaleStaticSize<FixedBytes<N>>::value;
+        return *this;
+    }
+
+    template <class T>
+    ScaleSizeCounter& operator<<(const std::vector<T>& c)
+    {
+        return countCollection(c.size(), c.begin(), c.end());
+    }
+
+    template <class T>
+    ScaleSizeCounter& operator<<(const std::list<T>& c)
+    {
+        return countCollection(c.size(), c.begin(), c.end());
+    }
+
+    template <class T, class F>
+    ScaleSizeCounter& operator<<(const std::map<T, F>& c)
+    {
+        return countCollection(c.size(), c.begin(), c.end());
+    }
+
+    template <class T>
+    ScaleSizeCounter& operator<<(const boost::optional<T>& v)
+    {
+        // the optional bool is encoded into one byte
+        m_size += 1;
+        if constexpr (!std::is_same_v<T, bool>)
+        {
+            if (v.has_value())
+            {
+                *this << *v;
+            }
+        }
+        return *this;
+    }
+
+    template <class T>
+    ScaleSizeCounter& operator<<(const gsl::span<T>& v)
+    {
+        return countCollection(v.size(), v.begin(), v.end());
+    }
+
+    template <typename T, size_t size>
+    ScaleSizeCounter& operator<<(const std::array<T, size>& a)
+    {
+        if constexpr (ScaleStaticSize<std::array<T, size>>::value > 0)
+        {
+            m_size += ScaleStaticSize<std::array<T, size>>::value;
+            return *this;
+        }
+        for (const auto& e : a)
+        {
+            *this << e;
+        }
+        return *this;
+    }
+
+    template <class T>
+    ScaleSizeCounter& operator<<(const std::reference_wrapper<T>& v)
+    {
+        return *this << static_cast<const T&>(v);
+    }
+
+    ScaleSizeCounter& operator<<(std::string_view sv)
+    {
+        m_size += compactLengthSize(sv.size()) + sv.size();
+        return *this;
+    }
+
+    template <typename T, typename I = std::decay_t<T>,
+        typename = std::enable_if_t<std::is_integral<I>::value>>
+    ScaleSizeCounter& operator<<(T&&)
+    {
+        m_size += ScaleStaticSize<I>::value;
+        return *this;
+    }
+
+    ScaleSizeCounter& operator<<(const CompactInteger& v)
+    {
+        if (v < EncodingCategoryLimits::kMinBigInteger)
+        {
+            m_size += compactLengthSize(v.convert_to<size_t>());
+            return *this;
+        }
+        m_size += 1 + countBytes(v);
+        return *this;
+    }
+
+    ScaleSizeCounter& operator<<(s256 const&)
+    {
+        m_size += ScaleStaticSize<s256>::value;
+        return *this;
+    }
+
+    ScaleSizeCounter& operator<<(const u256&)
+    {
+        m_size += ScaleStaticSize<u256>::value;
+        return *this;
+    }
+
+private:
+    template <class It>
+    ScaleSizeCounter& countCollection(size_t _size, It&& _begin, It&& _end)
+    {
+        using T = std::decay_t<decltype(*_begin)>;
+        m_size += compactLengthSize(_size);
+        // the collection of static-size items is counted without iteration
+        if constexpr (ScaleStaticSize<T>::value > 0)
+        {
+            m_size += _size * ScaleStaticSize<T>::value;
+            return *this;
+        }
+        for (auto&& it = _begin; it != _end; ++it)
+        {
+            *this << *it;
+        }
+        return *this;
+    }
+
+    size_t m_size = 0;
+};
+
+/**
+ * @brief the size of the data encoded from the given values by ScaleEncoderStream, used to
+ * allocate the encoding buffer once
+ * @param _args the values to be encoded
+ * @return the encoded size in bytes
+ */
+template <typename... Args>
+size_t scaleEncodedSize(Args const&... _args)
+{
+    ScaleSizeCounter counter;
+    (counter << ... << _args);
+    return counter.size();
+}
+}  // namespace scale
+}  // namespace codec
+}  // namespace bcos
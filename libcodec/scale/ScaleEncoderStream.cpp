@@ -123,20 +123,39 @@ void encodeCompactInteger(const CompactInteger& value, ScaleEncoderStream& out)
 ScaleEncoderStream& ScaleEncoderStream::operator<<(const u256& _value)
 {
     // convert u256 to big-edian bytes(Note: must be 32bytes)
-    bytes bigEndianData = toBigEndian(_value);
-    m_stream.insert(m_stream.end(), bigEndianData.begin(), bigEndianData.end());
-    return *this;
+    std::array<byte, 32> bigEndianData;
+    toBigEndian(_value, bigEndianData);
+    return write(bigEndianData.data(), bigEndianData.size());
 }
 
 bytes ScaleEncoderStream::data() const
 {
-    bytes buffer(m_stream.size(), 0u);
-    buffer.assign(m_stream.begin(), m_stream.end());
-    return buffer;
+    if (m_externalBuffer)
+    {
+        return bytes(m_externalBuffer, m_externalBuffer + m_externalSize);
+    }
+    return m_buffer;
+}
+
+bytes ScaleEncoderStream::take()
+{
+    if (m_externalBuffer)
+    {
+        auto encodedData = data();
+        m_externalSize = 0;
+        return encodedData;
+    }
+    bytes encodedData;
+    encodedData.swap(m_buffer);
+    return encodedData;
 }
 
 ScaleEncoderStream& ScaleEncoderStream::operator<<(const CompactInteger& v)
 {
+    if (v >= 0 && v < EncodingCategoryLimits::kMinBigInteger)
+    {
+        return encodeCompactLength(v.convert_to<size_t>());
+    }
     encodeCompactInteger(v, *this);
     return *this;
 }
@@ -19,9 +19,11 @@
 #pragma once
 #include "../../libutilities/FixedBytes.h"
 #include "FixedWidthIntegerCodec.h"
+#include <boost/endian/conversion.hpp>
 #include <boost/optional.hpp>
 #include <boost/variant.hpp>
-#include <deque>
+#include <algorithm>
+#include <cstring>
 #include <gsl/span>
 #include <type_traits>
 
@@ -37,8 +39,31 @@ public:
     // special tag to differentiate encoding streams from others
     static constexpr auto is_encoder_stream = true;
 
+    ScaleEncoderStream() = default;
+    // encode into the caller-provided _buffer, throw ScaleEncodeException if it overflows
+    ScaleEncoderStream(byte* _buffer, size_t _capacity)
+      : m_externalBuffer(_buffer), m_capacity(_capacity)
+    {}
+
     // get the encoded data
     bytes data() const;
+    // move the encoded data out without copy, the stream is empty afterwards
+    bytes take();
+    // the size of the encoded data
+    size_t size() const { return m_externalBuffer ? m_externalSize : m_buffer.size(); }
+    // copy the encoded data into _buffer, which must hold at least size() bytes
+    void copyTo(byte* _buffer) const
+    {
+        auto data = m_externalBuffer ? m_externalBuffer : m_buffer.data();
+        std::memcpy(_buffer, data, size());
+    }
+    void reserve(size_t _size)
+    {
+        if (!m_externalBuffer)
+        {
+            m_buffer.reserve(_size);
+        }
+    }
 
     /**
      * @brief scale-encodes pair of values
@@ -119,7 +144,10 @@ public:
     template <unsigned N>
     ScaleEncoderStream& operator<<(const FixedBytes<N>& fixedData)
     {
-        return encodeCollection((size_t)FixedBytes<N>::size, fixedData.begin(), fixedData.end());
+        // the length prefix is known at compile time
+        static constexpr auto c_lengthPrefix = compactLengthPrefix<N>();
+        write(c_lengthPrefix.data(), c_lengthPrefix.size());
+        return write(fixedData.data(), N);
     }
 
     /**
@@ -131,7 +159,14 @@ public:
     template <class T>
     ScaleEncoderStream& operator<<(const std::vector<T>& c)
     {
-        return encodeCollection(c.size(), c.begin(), c.end());
+        if constexpr (isBulkEncodable<T>())
+        {
+            return encodeBulk(c.size(), c.data());
+        }
+        else
+        {
+            return encodeCollection(c.size(), c.begin(), c.end());
+        }
     }
 
     /**
@@ -190,7 +225,14 @@ public:
     template <class T>
     ScaleEncoderStream& operator<<(const gsl::span<T>& v)
     {
-        return encodeCollection(v.size(), v.begin(), v.end());
+        if constexpr (isBulkEncodable<T>())
+        {
+            return encodeBulk(v.size(), v.data());
+        }
+        else
+        {
+            return encodeCollection(v.size(), v.begin(), v.end());
+        }
     }
 
     /**
@@ -203,6 +245,10 @@ public:
     template <typename T, size_t size>
     ScaleEncoderStream& operator<<(const std::array<T, size>& a)
     {
+        if constexpr (isBulkEncodable<T>())
+        {
+            return write((byte const*)a.data(), size * sizeof(T));
+        }
         for (const auto& e : a)
         {
             *this << e;
@@ -229,7 +275,7 @@ public:
      */
     ScaleEncoderStream& operator<<(std::string_view sv)
     {
-        return encodeCollection(sv.size(), sv.begin(), sv.end());
+        return encodeBulk(sv.size(), sv.data());
     }
 
     /**
@@ -249,14 +295,18 @@ public:
             return putByte(byte);
         }
         // put byte
-        if constexpr (sizeof(T) == 1u)
+        else if constexpr (sizeof(T) == 1u)
         {
             // to avoid infinite recursion
             return putByte(static_cast<uint8_t>(v));
         }
-        // encode any other integer
-        encodeInteger<I>(v, *this);
-        return *this;
+        else
+        {
+            // encode any other integer in little-endian
+            boost::endian::endian_buffer<boost::endian::order::little, I, sizeof(I) * 8> buffer{};
+            buffer = v;
+            return write((byte const*)buffer.data(), sizeof(I));
+        }
     }
 
     /**
@@ -309,9 +359,9 @@ protected:
      * @return reference to stream
      */
     template <class It>
-    ScaleEncoderStream& encodeCollection(const CompactInteger& size, It&& begin, It&& end)
+    ScaleEncoderStream& encodeCollection(size_t size, It&& begin, It&& end)
     {
-        *this << size;
+        encodeCompactLength(size);
         for (auto&& it = begin; it != end; ++it)
         {
             *this << *it;
@@ -319,6 +369,41 @@ protected:
         return *this;
     }
 
+    // the items whose scale encoding is the same as their memory representation
+    template <class T>
+    static constexpr bool isBulkEncodable()
+    {
+        using I = std::remove_cv_t<T>;
+        return std::is_integral_v<I> && !std::is_same_v<I, bool> &&
+               (sizeof(I) == 1 || boost::endian::order::native == boost::endian::order::little);
+    }
+
+    // scale-encodes the collection of _size items at _data with one copy
+    template <class T>
+    ScaleEncoderStream& encodeBulk(size_t _size, T const* _data)
+    {
+        encodeCompactLength(_size);
+        return write((byte const*)_data, _size * sizeof(T));
+    }
+
+    // compact-encodes the collection size without CompactInteger
+    ScaleEncoderStream& encodeCompactLength(size_t _length)
+    {
+        if (_length < EncodingCategoryLimits::kMinUint16)
+        {
+            return putByte(static_cast<uint8_t>(_length << 2u));
+        }
+        if (_length < EncodingCategoryLimits::kMinUint32)
+        {
+            return *this << static_cast<uint16_t>((_length << 2u) + 1u);
+        }
+        if (_length < EncodingCategoryLimits::kMinBigInteger)
+        {
+            return *this << static_cast<uint32_t>((_length << 2u) + 2u);
+        }
+        return *this << CompactInteger(_length);
+    }
+
     /**
      * @brief puts a byte to buffer
      * @param v byte value
@@ -326,14 +411,41 @@ protected:
      */
     ScaleEncoderStream& putByte(uint8_t v)
     {
-        m_stream.emplace_back(v);
+        if (!m_externalBuffer)
+        {
+            m_buffer.push_back(v);
+            return *this;
+        }
+        return write(&v, 1);
+    }
+
+    // appends _size bytes at _data
+    ScaleEncoderStream& write(byte const* _data, size_t _size)
+    {
+        if (!m_externalBuffer)
+        {
+            m_buffer.insert(m_buffer.end(), _data, _data + _size);
+            return *this;
+        }
+        if (_size > m_capacity - m_externalSize)
+        {
+            BOOST_THROW_EXCEPTION(ScaleEncodeException() << errinfo_comment(
+                                      "encode exception for BUFFER_OVERFLOW, capacity: " +
+                                      std::to_string(m_capacity)));
+        }
+        std::memcpy(m_externalBuffer + m_externalSize, _data, _size);
+        m_externalSize += _size;
         return *this;
     }
 
 private:
     ScaleEncoderStream& encodeOptionalBool(const boost::optional<bool>& v);
-    // std::deque<uint8_t> m_stream;
-    std::deque<uint8_t> m_stream;
+    // the growable buffer, used if m_externalBuffer is nullptr
+    bytes m_buffer;
+    // the caller-provided buffer of m_capacity bytes
+    byte* m_externalBuffer = nullptr;
+    size_t m_capacity = 0;
+    size_t m_externalSize = 0;
 };
 }  // namespace scale
 }  // namespace codec
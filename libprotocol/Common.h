@@ -20,6 +20,7 @@
 #pragma once
 #include "../libutilities/DataConvertUtility.h"
 #include "../libutilities/Exceptions.h"
+#include <google/protobuf/descriptor.h>
 
 namespace bcos
 {
@@ -27,31 +28,60 @@ namespace protocol
 {
 DERIVE_BCOS_EXCEPTION(PBObjectEncodeException);
 DERIVE_BCOS_EXCEPTION(PBObjectDecodeException);
-template <typename T>
-bytesPointer encodePBObject(T _pbObject)
+// the number of the field _name (in lower case) of the message described by _descriptor
+inline int pbFieldNumber(google::protobuf::Descriptor const* _descriptor, std::string const& _name)
 {
-    auto encodedData = std::make_shared<bytes>();
-    encodedData->resize(_pbObject->ByteSizeLong());
-    if (_pbObject->SerializeToArray(encodedData->data(), encodedData->size()))
+    auto field = _descriptor->FindFieldByLowercaseName(_name);
+    if (!field)
     {
-        return encodedData;
+        BOOST_THROW_EXCEPTION(PBObjectDecodeException() << errinfo_comment(
+                                  "the field " + _name + " not found in " + _descriptor->name()));
     }
-    BOOST_THROW_EXCEPTION(
-        PBObjectEncodeException() << errinfo_comment("encode PBObject into bytes data failed"));
+    return field->number();
 }
-
+// Note: the sizes of _pbObject must have been cached by ByteSizeLong
 template <typename T>
-void encodePBObject(bytes& _encodedData, T _pbObject)
+void encodePBObjectWithCachedSizes(byte* _buffer, size_t _size, T const& _pbObject)
 {
-    auto encodedData = std::make_shared<bytes>();
-    _encodedData.resize(_pbObject->ByteSizeLong());
-    if (!_pbObject->SerializeToArray(_encodedData.data(), _encodedData.size()))
+    auto end = _pbObject->SerializeWithCachedSizesToArray(_buffer);
+    if ((size_t)(end - _buffer) != _size)
     {
         BOOST_THROW_EXCEPTION(
             PBObjectEncodeException() << errinfo_comment("encode PBObject into bytes data failed"));
     }
 }
 
+template <typename T>
+bytesPointer encodePBObject(T _pbObject)
+{
+    auto encodedData = std::make_shared<bytes>(_pbObject->ByteSizeLong());
+    encodePBObjectWithCachedSizes(encodedData->data(), encodedData->size(), _pbObject);
+    return encodedData;
+}
+
+// serialize _pbObject straight into _encodedData
+template <typename T>
+void encodePBObject(bytes& _encodedData, T _pbObject)
+{
+    _encodedData.resize(_pbObject->ByteSizeLong());
+    encodePBObjectWithCachedSizes(_encodedData.data(), _encodedData.size(), _pbObject);
+}
+
+// serialize _pbObject straight into _encodedData, used to fill the bytes field of protobuf
+template <typename T>
+void encodePBObject(std::string& _encodedData, T _pbObject)
+{
+    _encodedData.resize(_pbObject->ByteSizeLong());
+    encodePBObjectWithCachedSizes((byte*)_encodedData.data(), _encodedData.size(), _pbObject);
+}
+
+// create the PBObject on the given protobuf arena, the returned pointer keeps the arena alive
+template <typename T, typename ArenaType>
+std::shared_ptr<T> createPBObjectOnArena(std::shared_ptr<ArenaType> _arena)
+{
+    return std::shared_ptr<T>(_arena, ArenaType::template CreateMessage<T>(_arena.get()));
+}
+
 template <typename T>
 void decodePBObject(T _pbObject, bytesConstRef _data)
 {
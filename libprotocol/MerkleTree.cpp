@@ -0,0 +1,256 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the merkle tree that keeps all the levels to update the root incrementally
+ * @file MerkleTree.cpp
+ * @author: yujiechen
+ * @date: 2021-10-18
+ */
+#include "MerkleTree.h"
+#include "../libcodec/scale/Scale.h"
+#include <tbb/parallel_for.h>
+#include <algorithm>
+
+using namespace bcos;
+using namespace bcos::crypto;
+using namespace bcos::protocol;
+
+namespace
+{
+const size_t c_maxChildCount = 16;
+}
+
+void MerkleTree::setLeaves(std::vector<bytes>&& _leaves)
+{
+    m_leaves = std::move(_leaves);
+    m_levels.clear();
+    m_dirtyLeaves.clear();
+    m_allDirty = true;
+}
+
+void MerkleTree::setLeaf(size_t _index, bytes&& _leaf)
+{
+    if (_index > m_leaves.size())
+    {
+        BOOST_THROW_EXCEPTION(InvalidParameter() << errinfo_comment(
+                                  "MerkleTree: setLeaf out of range, index: " +
+                                  std::to_string(_index) +
+                                  ", leavesSize: " + std::to_string(m_leaves.size())));
+    }
+    if (_index == m_leaves.size())
+    {
+        m_leaves.emplace_back(std::move(_leaf));
+    }
+    else
+    {
+        m_leaves[_index] = std::move(_leaf);
+    }
+    if (!m_allDirty)
+    {
+        m_dirtyLeaves.emplace_back(_index);
+    }
+}
+
+HashType MerkleTree::hashChildren(size_t _level, size_t _parentIndex) const
+{
+    auto begin = _parentIndex * c_maxChildCount;
+    if (_level == 0)
+    {
+        auto end = std::min(begin + c_maxChildCount, m_leaves.size());
+        bytes childrenData;
+        for (auto i = begin; i < end; i++)
+        {
+            childrenData.insert(childrenData.end(), m_leaves[i].begin(), m_leaves[i].end());
+        }
+        return m_cryptoSuite->hash(childrenData);
+    }
+    // the hashes of the children are contiguous
+    auto const& children = m_levels[_level - 1];
+    auto end = std::min(begin + c_maxChildCount, children.size());
+    return m_cryptoSuite->hash(
+        bytesConstRef(children[begin].data(), (end - begin) * HashType::size));
+}
+
+HashType MerkleTree::root()
+{
+    if (m_leaves.empty())
+    {
+        return m_cryptoSuite->hash(bytes());
+    }
+    if (!m_allDirty && m_dirtyLeaves.empty())
+    {
+        return m_root;
+    }
+    std::sort(m_dirtyLeaves.begin(), m_dirtyLeaves.end());
+    m_dirtyLeaves.erase(
+        std::unique(m_dirtyLeaves.begin(), m_dirtyLeaves.end()), m_dirtyLeaves.end());
+    std::vector<size_t> dirtyIndexes = std::move(m_dirtyLeaves);
+    m_dirtyLeaves.clear();
+
+    size_t level = 0;
+    size_t childrenSize = m_leaves.size();
+    while (childrenSize > 1)
+    {
+        auto parentsSize = (childrenSize + c_maxChildCount - 1) / c_maxChildCount;
+        if (m_levels.size() <= level)
+        {
+            m_levels.emplace_back();
+        }
+        m_levels[level].resize(parentsSize);
+        // the parents of the dirty children are dirty
+        std::vector<size_t> dirtyParents;
+        if (!m_allDirty)
+        {
+            for (auto index : dirtyIndexes)
+            {
+                auto parentIndex = index / c_maxChildCount;
+                if (dirtyParents.empty() || dirtyParents.back() != parentIndex)
+                {
+                    dirtyParents.emplace_back(parentIndex);
+                }
+            }
+        }
+        auto dirtyParentsSize = m_allDirty ? parentsSize : dirtyParents.size();
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, dirtyParentsSize),
+            [&](const tbb::blocked_range<size_t>& _r) {
+                for (auto i = _r.begin(); i < _r.end(); ++i)
+                {
+                    auto parentIndex = m_allDirty ? i : dirtyParents[i];
+                    m_levels[level][parentIndex] = hashChildren(level, parentIndex);
+                }
+            });
+        dirtyIndexes = std::move(dirtyParents);
+        childrenSize = parentsSize;
+        level++;
+    }
+    // the tree may become lower after setLeaves
+    m_levels.resize(level);
+    m_allDirty = false;
+    if (level == 0)
+    {
+        m_root = m_cryptoSuite->hash(m_leaves[0]);
+    }
+    else
+    {
+        m_root = m_cryptoSuite->hash(m_levels[level - 1][0].ref());
+    }
+    return m_root;
+}
+
+MerkleTree::Proof MerkleTree::proof(size_t _index)
+{
+    if (_index >= m_leaves.size())
+    {
+        BOOST_THROW_EXCEPTION(InvalidParameter() << errinfo_comment(
+                                  "MerkleTree: proof out of range, index: " +
+                                  std::to_string(_index) +
+                                  ", leavesSize: " + std::to_string(m_leaves.size())));
+    }
+    root();
+    Proof proof;
+    if (m_levels.empty())
+    {
+        return proof;
+    }
+    proof.positions.reserve(m_levels.size());
+    proof.siblings.reserve(m_levels.size() - 1);
+    auto index = _index;
+    for (size_t level = 0; level < m_levels.size(); level++)
+    {
+        auto begin = (index / c_maxChildCount) * c_maxChildCount;
+        auto childrenSize = (level == 0 ? m_leaves.size() : m_levels[level - 1].size());
+        auto end = std::min(begin + c_maxChildCount, childrenSize);
+        proof.positions.emplace_back((uint8_t)(index - begin));
+        if (level == 0)
+        {
+            auto leaves = m_leaves.begin();
+            proof.leaves.insert(proof.leaves.end(), leaves + begin, leaves + index);
+            proof.leaves.insert(proof.leaves.end(), leaves + index + 1, leaves + end);
+        }
+        else
+        {
+            auto const& children = m_levels[level - 1];
+            std::vector<HashType> siblings(children.begin() + begin, children.begin() + index);
+            siblings.insert(siblings.end(), children.begin() + index + 1, children.begin() + end);
+            proof.siblings.emplace_back(std::move(siblings));
+        }
+        index /= c_maxChildCount;
+    }
+    return proof;
+}
+
+bytes MerkleTree::encodeProof(Proof const& _proof)
+{
+    codec::scale::ScaleEncoderStream stream;
+    stream.reserve(
+        codec::scale::scaleEncodedSize(_proof.positions, _proof.leaves, _proof.siblings));
+    stream << _proof.positions << _proof.leaves << _proof.siblings;
+    return stream.take();
+}
+
+MerkleTree::Proof MerkleTree::decodeProof(bytesConstRef _data)
+{
+    Proof proof;
+    codec::scale::ScaleDecoderStream stream(gsl::span<const byte>(_data.data(), _data.size()));
+    stream >> proof.positions >> proof.leaves >> proof.siblings;
+    return proof;
+}
+
+bool MerkleTree::verifyProof(CryptoSuite::Ptr _cryptoSuite, HashType const& _root,
+    bytesConstRef _leaf, Proof const& _proof)
+{
+    // the tree with only one leaf
+    if (_proof.positions.empty())
+    {
+        return _proof.leaves.empty() && _proof.siblings.empty() &&
+               _cryptoSuite->hash(_leaf) == _root;
+    }
+    if (_proof.siblings.size() + 1 != _proof.positions.size() ||
+        _proof.leaves.size() >= c_maxChildCount || _proof.positions[0] > _proof.leaves.size())
+    {
+        return false;
+    }
+    bytes childrenData;
+    for (size_t i = 0; i <= _proof.leaves.size(); i++)
+    {
+        if (i == _proof.positions[0])
+        {
+            childrenData.insert(childrenData.end(), _leaf.begin(), _leaf.end());
+        }
+        if (i < _proof.leaves.size())
+        {
+            childrenData.insert(
+                childrenData.end(), _proof.leaves[i].begin(), _proof.leaves[i].end());
+        }
+    }
+    auto node = _cryptoSuite->hash(childrenData);
+    for (size_t level = 0; level < _proof.siblings.size(); level++)
+    {
+        auto const& siblings = _proof.siblings[level];
+        auto position = _proof.positions[level + 1];
+        if (siblings.size() >= c_maxChildCount || position > siblings.size())
+        {
+            return false;
+        }
+        std::vector<HashType> children;
+        children.reserve(siblings.size() + 1);
+        children.insert(children.end(), siblings.begin(), siblings.begin() + position);
+        children.emplace_back(node);
+        children.insert(children.end(), siblings.begin() + position, siblings.end());
+        node = _cryptoSuite->hash(
+            bytesConstRef(children[0].data(), children.size() * HashType::size));
+    }
+    return _cryptoSuite->hash(node.ref()) == _root;
+}
@@ -0,0 +1,83 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the merkle tree that keeps all the levels to update the root incrementally
+ * @file MerkleTree.h
+ * @author: yujiechen
+ * @date: 2021-10-18
+ */
+#pragma once
+#include "../interfaces/crypto/CryptoSuite.h"
+#include "../libutilities/FixedBytes.h"
+#include <vector>
+
+namespace bcos
+{
+namespace protocol
+{
+// MerkleTree has the same shape and root as calculateMerkleProofRoot: every node hashes the
+// concatenation of its (at most 16) children, and the root is the hash of the top node.
+// Modifying a leaf only recalculates the nodes on the path from the leaf to the root.
+class MerkleTree
+{
+public:
+    using Ptr = std::shared_ptr<MerkleTree>;
+    // the merkle proof of a leaf, level by level from the leaves to the top node
+    struct Proof
+    {
+        // the position of the proved node among the children of its parent
+        std::vector<uint8_t> positions;
+        // the other leaves with the same parent as the proved leaf
+        std::vector<bytes> leaves;
+        // the siblings of the proved node on every level above the leaves
+        std::vector<std::vector<bcos::crypto::HashType>> siblings;
+    };
+    explicit MerkleTree(bcos::crypto::CryptoSuite::Ptr _cryptoSuite) : m_cryptoSuite(_cryptoSuite)
+    {}
+    virtual ~MerkleTree() {}
+
+    // reset the tree with the given leaves
+    virtual void setLeaves(std::vector<bytes>&& _leaves);
+    // update the given leaf, the leaf is appended if _index equals to leavesSize()
+    virtual void setLeaf(size_t _index, bytes&& _leaf);
+    size_t leavesSize() const { return m_leaves.size(); }
+
+    // the root of the tree, only the dirty paths are recalculated
+    virtual bcos::crypto::HashType root();
+
+    // the proof of the _index-th leaf, O(log16(n)) once the root has been calculated
+    virtual Proof proof(size_t _index);
+    static bytes encodeProof(Proof const& _proof);
+    static Proof decodeProof(bytesConstRef _data);
+    // check whether the _leaf with _proof belongs to the tree with _root
+    static bool verifyProof(bcos::crypto::CryptoSuite::Ptr _cryptoSuite,
+        bcos::crypto::HashType const& _root, bytesConstRef _leaf, Proof const& _proof);
+
+private:
+    bcos::crypto::HashType hashChildren(size_t _level, size_t _parentIndex) const;
+
+private:
+    bcos::crypto::CryptoSuite::Ptr m_cryptoSuite;
+    std::vector<bytes> m_leaves;
+    // m_levels[i] is the (i+1)th level above the leaves
+    std::vector<std::vector<bcos::crypto::HashType>> m_levels;
+    bcos::crypto::HashType m_root;
+
+    bool m_allDirty = true;
+    // the sorted indexes of the modified leaves
+    std::vector<size_t> m_dirtyLeaves;
+};
+}  // namespace protocol
+}  // namespace bcos
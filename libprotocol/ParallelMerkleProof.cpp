@@ -29,6 +29,81 @@ using namespace bcos::crypto;
 
 const uint32_t MAX_CHILD_COUNT = 16;
 
+// the hashes of one level are stored contiguously and hashed in place
+static_assert(sizeof(HashType) == HashType::size, "HashType must be packed");
+
+namespace
+{
+size_t parentsSize(size_t _childrenSize)
+{
+    return (_childrenSize + MAX_CHILD_COUNT - 1) / MAX_CHILD_COUNT;
+}
+
+// calculate the lowest level of the tree, every node hashes the concatenation of its leaves
+void hashLeaves(CryptoSuite::Ptr _cryptoSuite, const std::vector<bcos::bytes>& _leaves,
+    std::vector<HashType>& _parents)
+{
+    _parents.resize(parentsSize(_leaves.size()));
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, _parents.size()),
+        [&](const tbb::blocked_range<size_t>& _r) {
+            // reused by all the nodes of the range
+            bytes byteValue;
+            for (auto i = _r.begin(); i < _r.end(); ++i)
+            {
+                byteValue.clear();
+                auto end = std::min((i + 1) * MAX_CHILD_COUNT, _leaves.size());
+                for (auto index = i * MAX_CHILD_COUNT; index < end; index++)
+                {
+                    byteValue.insert(byteValue.end(), _leaves[index].begin(), _leaves[index].end());
+                }
+                _parents[i] = _cryptoSuite->hash(byteValue);
+            }
+        });
+}
+
+// calculate the upper level of the tree, the children of every node are hashed in place
+void hashLevel(CryptoSuite::Ptr _cryptoSuite, const std::vector<HashType>& _children,
+    std::vector<HashType>& _parents)
+{
+    _parents.resize(parentsSize(_children.size()));
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, _parents.size()),
+        [&](const tbb::blocked_range<size_t>& _r) {
+            for (auto i = _r.begin(); i < _r.end(); ++i)
+            {
+                auto begin = i * MAX_CHILD_COUNT;
+                auto end = std::min(begin + MAX_CHILD_COUNT, _children.size());
+                _parents[i] = _cryptoSuite->hash(
+                    bytesConstRef(_children[begin].data(), (end - begin) * HashType::size));
+            }
+        });
+}
+
+// record the children of every parent node into _parent2ChildList
+template <typename T>
+void recordChildren(const std::vector<T>& _children, const std::vector<HashType>& _parents,
+    std::map<std::string, std::vector<std::string>>& _parent2ChildList)
+{
+    std::mutex mapMutex;
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, _parents.size()),
+        [&](const tbb::blocked_range<size_t>& _r) {
+            for (auto i = _r.begin(); i < _r.end(); ++i)
+            {
+                auto parentNode = *toHexString(_parents[i]);
+                std::vector<std::string> childList;
+                auto end = std::min((i + 1) * MAX_CHILD_COUNT, _children.size());
+                for (auto index = i * MAX_CHILD_COUNT; index < end; index++)
+                {
+                    childList.emplace_back(*toHexString(_children[index]));
+                }
+                std::lock_guard<std::mutex> l(mapMutex);
+                auto& children = _parent2ChildList[parentNode];
+                children.insert(children.end(), std::make_move_iterator(childList.begin()),
+                    std::make_move_iterator(childList.end()));
+            }
+        });
+}
+}  // namespace
+
 HashType bcos::protocol::calculateMerkleProofRoot(
     CryptoSuite::Ptr _cryptoSuite, const std::vector<bcos::bytes>& _bytesCaches)
 {
@@ -36,36 +111,22 @@ HashType bcos::protocol::calculateMerkleProofRoot(
     {
         return _cryptoSuite->hash(bytes());
     }
-    std::vector<bcos::bytes> bytesCachesTemp;
-    bytesCachesTemp.insert(bytesCachesTemp.end(),
-        std::make_move_iterator(const_cast<std::vector<bcos::bytes>&>(_bytesCaches).begin()),
-        std::make_move_iterator(const_cast<std::vector<bcos::bytes>&>(_bytesCaches).end()));
-
-    while (bytesCachesTemp.size() > 1)
+    if (_bytesCaches.size() == 1)
     {
-        std::vector<bcos::bytes> higherLevelList;
-        int size = (bytesCachesTemp.size() + MAX_CHILD_COUNT - 1) / MAX_CHILD_COUNT;
-        higherLevelList.resize(size);
-        tbb::parallel_for(
-            tbb::blocked_range<size_t>(0, size), [&](const tbb::blocked_range<size_t>& _r) {
-                for (uint32_t i = _r.begin(); i < _r.end(); ++i)
-                {
-                    bytes byteValue;
-                    for (uint32_t j = 0; j < MAX_CHILD_COUNT; j++)
-                    {
-                        uint32_t index = i * MAX_CHILD_COUNT + j;
-                        if (index < bytesCachesTemp.size())
-                        {
-                            byteValue.insert(byteValue.end(), bytesCachesTemp[index].begin(),
-                                bytesCachesTemp[index].end());
-                        }
-                    }
-                    higherLevelList[i] = _cryptoSuite->hash(byteValue).asBytes();
-                }
-            });
-        bytesCachesTemp = std::move(higherLevelList);
+        return _cryptoSuite->hash(_bytesCaches[0]);
+    }
+    // the two levels are swapped after calculating every upper level
+    std::vector<HashType> children;
+    std::vector<HashType> parents;
+    parents.reserve(parentsSize(_bytesCaches.size()));
+    children.reserve(parentsSize(parents.capacity()));
+    hashLeaves(_cryptoSuite, _bytesCaches, parents);
+    while (parents.size() > 1)
+    {
+        std::swap(children, parents);
+        hashLevel(_cryptoSuite, children, parents);
     }
-    return _cryptoSuite->hash(bytesCachesTemp[0]);
+    return _cryptoSuite->hash(parents[0].ref());
 }
 
 void bcos::protocol::calculateMerkleProof(bcos::crypto::CryptoSuite::Ptr _cryptoSuite,
@@ -76,44 +137,24 @@ void bcos::protocol::calculateMerkleProof(bcos::crypto::CryptoSuite::Ptr _crypto
     {
         return;
     }
-    std::vector<bcos::bytes> bytesCachesTemp;
-    bytesCachesTemp.insert(bytesCachesTemp.end(),
-        std::make_move_iterator(const_cast<std::vector<bcos::bytes>&>(_bytesCaches).begin()),
-        std::make_move_iterator(const_cast<std::vector<bcos::bytes>&>(_bytesCaches).end()));
-    std::mutex mapMutex;
-    while (bytesCachesTemp.size() > 1)
+    if (_bytesCaches.size() == 1)
     {
-        std::vector<bcos::bytes> higherLevelList;
-        int size = (bytesCachesTemp.size() + MAX_CHILD_COUNT - 1) / MAX_CHILD_COUNT;
-        higherLevelList.resize(size);
-        tbb::parallel_for(
-            tbb::blocked_range<size_t>(0, size), [&](const tbb::blocked_range<size_t>& _r) {
-                for (uint32_t i = _r.begin(); i < _r.end(); ++i)
-                {
-                    bytes byteValue;
-                    std::vector<bcos::bytes> childList;
-                    for (uint32_t j = 0; j < MAX_CHILD_COUNT; j++)
-                    {
-                        uint32_t index = i * MAX_CHILD_COUNT + j;
-                        if (index < bytesCachesTemp.size())
-                        {
-                            byteValue.insert(byteValue.end(), bytesCachesTemp[index].begin(),
-                                bytesCachesTemp[index].end());
-                            childList.push_back(bytesCachesTemp[index]);
-                        }
-                    }
-                    higherLevelList[i] = _cryptoSuite->hash(byteValue).asBytes();
-                    std::lock_guard<std::mutex> l(mapMutex);
-                    std::string parentNode = *toHexString(higherLevelList[i]);
-                    for (const auto& child : childList)
-                    {
-                        (*_parent2ChildList)[parentNode].emplace_back(*toHexString(child));
-                    }
-                }
-            });
-        bytesCachesTemp = std::move(higherLevelList);
+        (*_parent2ChildList)[*toHexString(_cryptoSuite->hash(_bytesCaches[0]))].push_back(
+            *toHexString(_bytesCaches[0]));
+        return;
     }
-
-    (*_parent2ChildList)[*toHexString(_cryptoSuite->hash(bytesCachesTemp[0]).asBytes())].push_back(
-        *toHexString(bytesCachesTemp[0]));
+    std::vector<HashType> children;
+    std::vector<HashType> parents;
+    parents.reserve(parentsSize(_bytesCaches.size()));
+    children.reserve(parentsSize(parents.capacity()));
+    hashLeaves(_cryptoSuite, _bytesCaches, parents);
+    recordChildren(_bytesCaches, parents, *_parent2ChildList);
+    while (parents.size() > 1)
+    {
+        std::swap(children, parents);
+        hashLevel(_cryptoSuite, children, parents);
+        recordChildren(children, parents, *_parent2ChildList);
+    }
+    (*_parent2ChildList)[*toHexString(_cryptoSuite->hash(parents[0].ref()))].push_back(
+        *toHexString(parents[0]));
 }
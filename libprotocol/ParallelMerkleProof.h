@@ -31,6 +31,7 @@ namespace protocol
 {
 bcos::crypto::HashType calculateMerkleProofRoot(
     bcos::crypto::CryptoSuite::Ptr _cryptoSuite, const std::vector<bcos::bytes>& _bytesCaches);
+// Note: MerkleTree::proof provides the compact proof of the given leaf
 void calculateMerkleProof(bcos::crypto::CryptoSuite::Ptr _cryptoSuite,
     const std::vector<bcos::bytes>& _bytesCaches,
     std::shared_ptr<std::map<std::string, std::vector<std::string>>> _parent2ChildList);
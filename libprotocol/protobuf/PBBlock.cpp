@@ -21,15 +21,56 @@
 #include "PBBlock.h"
 #include "../../interfaces/protocol/Exceptions.h"
 #include "../Common.h"
+#include "PBBlockHeader.h"
+#include "PBTransactionFactory.h"
 #include "PBTransactionMetaData.h"
+#include "PBTransactionReceiptFactory.h"
 #include <tbb/parallel_invoke.h>
+#include <algorithm>
 
 using namespace bcos;
 using namespace bcos::protocol;
 using namespace bcos::crypto;
 
+void PBBlock::resetArena(size_t _dataSize)
+{
+    // return the ownership of the transactionsMetaData before releasing the raw block
+    clearTransactionMetaDataCache();
+    google::protobuf::ArenaOptions options;
+    // leave room for the receipts decoded into the arena besides the raw block
+    options.start_block_size = std::max(_dataSize * 2, options.start_block_size);
+    options.max_block_size = std::max(options.start_block_size, options.max_block_size);
+    m_arena = std::make_shared<google::protobuf::Arena>(options);
+    m_pbRawBlock = createPBObjectOnArena<PBRawBlock>(m_arena);
+}
+
+void PBBlock::detachRawTransactions()
+{
+    if (!m_rawTransactionsBorrowed)
+    {
+        return;
+    }
+    auto rawBlock = m_arena ? createPBObjectOnArena<PBRawBlock>(m_arena) :
+                              std::make_shared<PBRawBlock>();
+    // Note: swap the messages on the same arena without copy
+    rawBlock->Swap(m_pbRawBlock.get());
+    // leave the raw transactions to the old raw block, kept alive by the transactions
+    rawBlock->mutable_transactions()->Swap(m_pbRawBlock->mutable_transactions());
+    m_pbRawBlock = rawBlock;
+    m_rawTransactionsBorrowed = false;
+}
+
 void PBBlock::decode(bytesConstRef _data, bool _calculateHash, bool _checkSig)
 {
+    // the pending transactions refer to the raw block to be replaced
+    m_lazyTxsFlags.reset();
+    detachRawTransactions();
+    resetTxsMerkleTree();
+    resetReceiptsMerkleTree();
+    if (m_useArena)
+    {
+        resetArena(_data.size());
+    }
     decodePBObject(m_pbRawBlock, _data);
     tbb::parallel_invoke(
         [this]() {
@@ -65,9 +106,16 @@ void PBBlock::encode(bytes& _encodedData) const
             {
                 return;
             }
-            auto encodedData = std::make_shared<bytes>();
-            m_blockHeader->encode(*encodedData);
-            m_pbRawBlock->set_header(encodedData->data(), encodedData->size());
+            // encode the header into the header field directly
+            auto pbBlockHeader = std::dynamic_pointer_cast<PBBlockHeader>(m_blockHeader);
+            if (pbBlockHeader)
+            {
+                pbBlockHeader->encode(*m_pbRawBlock->mutable_header());
+                return;
+            }
+            bytes encodedData;
+            m_blockHeader->encode(encodedData);
+            m_pbRawBlock->set_header(encodedData.data(), encodedData.size());
         },
         [this]() {
             // encode transactions
@@ -85,8 +133,8 @@ void PBBlock::encode(bytes& _encodedData) const
             // encode the nonceList
             encodeNonceList();
         });
-    auto data = encodePBObject(m_pbRawBlock);
-    _encodedData = *data;
+    // serialize straight into _encodedData with the cached sizes
+    encodePBObject(_encodedData, m_pbRawBlock);
 }
 
 void PBBlock::decodeTransactionsMetaData()
@@ -94,8 +142,11 @@ void PBBlock::decodeTransactionsMetaData()
     m_transactionMetaDataList->clear();
     for (auto i = 0; i < m_pbRawBlock->transactionsmetadata_size(); i++)
     {
-        std::shared_ptr<PBRawTransactionMetaData> pbTxMetaData(
-            m_pbRawBlock->mutable_transactionsmetadata(i));
+        auto rawTxMetaData = m_pbRawBlock->mutable_transactionsmetadata(i);
+        // the metaData allocated on the arena is released together with the arena
+        auto pbTxMetaData = m_arena ?
+                                std::shared_ptr<PBRawTransactionMetaData>(m_arena, rawTxMetaData) :
+                                std::shared_ptr<PBRawTransactionMetaData>(rawTxMetaData);
         m_transactionMetaDataList->push_back(std::make_shared<PBTransactionMetaData>(pbTxMetaData));
     }
 }
@@ -128,18 +179,80 @@ void PBBlock::decodeTransactions(bool _calculateHash, bool _checkSig)
     m_transactions->clear();
     int txsNum = m_pbRawBlock->transactions_size();
     m_transactions->resize(txsNum);
+    m_rawTransactionsBorrowed =
+        (bool)std::dynamic_pointer_cast<PBTransactionFactory>(m_transactionFactory);
+    if (m_lazyDecodeTransactions)
+    {
+        // keep the raw transactions in m_pbRawBlock and decode them on first access
+        m_lazyCalculateHash = _calculateHash;
+        m_lazyCheckSig = _checkSig;
+        m_lazyTxsFlags = std::make_unique<std::once_flag[]>(txsNum);
+        return;
+    }
     tbb::parallel_for(tbb::blocked_range<int>(0, txsNum), [&](const tbb::blocked_range<int>& _r) {
         for (auto i = _r.begin(); i < _r.end(); i++)
         {
-            auto const& txData = m_pbRawBlock->transactions(i);
-            (*m_transactions)[i] = m_transactionFactory->createTransaction(
-                bytesConstRef((byte const*)txData.data(), txData.size()), _checkSig);
-            if (_calculateHash)
-            {
-                ((*m_transactions)[i])->hash();
-            }
+            (*m_transactions)[i] = decodeTransaction(i, _calculateHash, false);
         }
     });
+    if (!_checkSig)
+    {
+        return;
+    }
+    // verify the signatures in batch
+    auto invalidIndexes = verifyTransactions(m_transactionFactory->cryptoSuite(), *m_transactions);
+    if (!invalidIndexes.empty())
+    {
+        BOOST_THROW_EXCEPTION(
+            InvalidTransaction() << errinfo_comment(
+                "invalid transaction, index: " + std::to_string(invalidIndexes[0]) +
+                ", invalid transactions size: " + std::to_string(invalidIndexes.size())));
+    }
+}
+
+Transaction::Ptr PBBlock::decodeTransaction(int _index, bool _calculateHash, bool _checkSig) const
+{
+    auto const& txData = m_pbRawBlock->transactions(_index);
+    auto txDataRef = bytesConstRef((byte const*)txData.data(), txData.size());
+    Transaction::Ptr transaction;
+    auto pbTxFactory = std::dynamic_pointer_cast<PBTransactionFactory>(m_transactionFactory);
+    if (pbTxFactory)
+    {
+        // borrow the transaction data from the raw block without copy
+        transaction = pbTxFactory->createTransaction(txDataRef, m_pbRawBlock, _checkSig);
+    }
+    else
+    {
+        transaction = m_transactionFactory->createTransaction(txDataRef, _checkSig);
+    }
+    if (_calculateHash)
+    {
+        transaction->hash();
+    }
+    return transaction;
+}
+
+void PBBlock::lazyDecodeTransaction(size_t _index) const
+{
+    // Note: the flag is not set if decodeTransaction throws, so that it can be retried
+    std::call_once(m_lazyTxsFlags[_index], [this, _index]() {
+        (*m_transactions)[_index] = decodeTransaction(_index, m_lazyCalculateHash, m_lazyCheckSig);
+    });
+}
+
+void PBBlock::decodeAllTransactions() const
+{
+    if (!m_lazyTxsFlags)
+    {
+        return;
+    }
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_transactions->size()),
+        [&](const tbb::blocked_range<size_t>& _r) {
+            for (auto i = _r.begin(); i < _r.end(); i++)
+            {
+                lazyDecodeTransaction(i);
+            }
+        });
 }
 
 void PBBlock::decodeReceipts(bool _calculateHash)
@@ -153,13 +266,24 @@ void PBBlock::decodeReceipts(bool _calculateHash)
     m_receipts->clear();
     int receiptsNum = m_pbRawBlock->receipts_size();
     m_receipts->resize(receiptsNum);
+    auto pbReceiptFactory =
+        m_arena ? std::dynamic_pointer_cast<PBTransactionReceiptFactory>(m_receiptFactory) :
+                  nullptr;
     tbb::parallel_for(
         tbb::blocked_range<int>(0, receiptsNum), [&](const tbb::blocked_range<int>& _r) {
             for (auto i = _r.begin(); i < _r.end(); i++)
             {
                 auto const& receiptData = m_pbRawBlock->receipts(i);
-                (*m_receipts)[i] = m_receiptFactory->createReceipt(
-                    bytesConstRef((byte const*)receiptData.data(), receiptData.size()));
+                auto receiptDataRef =
+                    bytesConstRef((byte const*)receiptData.data(), receiptData.size());
+                if (pbReceiptFactory)
+                {
+                    (*m_receipts)[i] = pbReceiptFactory->createReceipt(receiptDataRef, m_arena);
+                }
+                else
+                {
+                    (*m_receipts)[i] = m_receiptFactory->createReceipt(receiptDataRef);
+                }
                 if (_calculateHash)
                 {
                     ((*m_receipts)[i])->hash();
@@ -249,20 +373,25 @@ void PBBlock::encodeNonceList() const
     {
         m_pbRawBlock->add_noncelist();
     }
-    int index = 0;
-    for (auto const& nonce : *m_nonceList)
+    // convert all the nonces at once into one buffer
+    bytes noncesData(nonceNum * 32);
+    u256sToBigEndian(*m_nonceList, noncesData.data());
+    for (size_t i = 0; i < nonceNum; i++)
     {
-        auto nonceBytes = toBigEndian(nonce);
-        m_pbRawBlock->set_noncelist(index++, nonceBytes.data(), nonceBytes.size());
+        m_pbRawBlock->set_noncelist((int)i, noncesData.data() + i * 32, 32);
     }
 }
 
 Transaction::ConstPtr PBBlock::transaction(size_t _index) const
 {
-    if (m_transactions->size() < _index)
+    if (m_transactions->size() <= _index)
     {
         return nullptr;
     }
+    if (m_lazyTxsFlags)
+    {
+        lazyDecodeTransaction(_index);
+    }
     return (*m_transactions)[_index];
 }
 
@@ -283,3 +412,153 @@ TransactionReceipt::ConstPtr PBBlock::receipt(size_t _index) const
     }
     return (*m_receipts)[_index];
 }
+
+HashType PBBlock::calculateTransactionRoot() const
+{
+    std::lock_guard<std::mutex> l(x_txsMerkleTree);
+    auto merkleTree = syncTxsMerkleTree();
+    // with no transactions
+    if (!merkleTree)
+    {
+        return HashType();
+    }
+    return merkleTree->root();
+}
+
+HashType PBBlock::calculateReceiptRoot() const
+{
+    std::lock_guard<std::mutex> l(x_receiptsMerkleTree);
+    auto merkleTree = syncReceiptsMerkleTree();
+    // with no receipts
+    if (!merkleTree)
+    {
+        return HashType();
+    }
+    return merkleTree->root();
+}
+
+std::vector<MerkleTree::Proof> PBBlock::transactionsMerkleProof(
+    std::vector<size_t> const& _indexes) const
+{
+    std::lock_guard<std::mutex> l(x_txsMerkleTree);
+    return merkleProof(syncTxsMerkleTree(), _indexes);
+}
+
+std::vector<MerkleTree::Proof> PBBlock::receiptsMerkleProof(
+    std::vector<size_t> const& _indexes) const
+{
+    std::lock_guard<std::mutex> l(x_receiptsMerkleTree);
+    return merkleProof(syncReceiptsMerkleTree(), _indexes);
+}
+
+std::vector<MerkleTree::Proof> PBBlock::merkleProof(
+    MerkleTree::Ptr _merkleTree, std::vector<size_t> const& _indexes) const
+{
+    if (!_merkleTree)
+    {
+        BOOST_THROW_EXCEPTION(InvalidParameter() << errinfo_comment(
+                                  "merkleProof failed for the block without leaves"));
+    }
+    std::vector<MerkleTree::Proof> proofs;
+    proofs.reserve(_indexes.size());
+    for (auto index : _indexes)
+    {
+        proofs.emplace_back(_merkleTree->proof(index));
+    }
+    return proofs;
+}
+
+MerkleTree::Ptr PBBlock::syncTxsMerkleTree() const
+{
+    if (transactionsSize() == 0 && transactionsMetaDataSize() == 0)
+    {
+        return nullptr;
+    }
+    bool fromMetaData = (transactionsSize() == 0);
+    auto hashFunc = [this, fromMetaData](size_t _index) {
+        return fromMetaData ? transactionMetaData(_index)->hash() : transaction(_index)->hash();
+    };
+    if (!m_txsMerkleTree || m_txsMerkleTreeFromMetaData != fromMetaData)
+    {
+        auto leavesSize = fromMetaData ? transactionsHashSize() : transactionsSize();
+        m_txsMerkleTree = std::make_shared<MerkleTree>(m_transactionFactory->cryptoSuite());
+        m_txsMerkleTree->setLeaves(encodeToCalculateRoot(leavesSize, hashFunc));
+        m_txsMerkleTreeFromMetaData = fromMetaData;
+        m_dirtyTxs.clear();
+        return m_txsMerkleTree;
+    }
+    // the appended leaves must be set in order
+    std::sort(m_dirtyTxs.begin(), m_dirtyTxs.end());
+    for (auto index : m_dirtyTxs)
+    {
+        m_txsMerkleTree->setLeaf(index, encodeMerkleLeaf(index, hashFunc(index)));
+    }
+    m_dirtyTxs.clear();
+    return m_txsMerkleTree;
+}
+
+MerkleTree::Ptr PBBlock::syncReceiptsMerkleTree() const
+{
+    if (receiptsSize() == 0)
+    {
+        return nullptr;
+    }
+    auto hashFunc = [this](size_t _index) { return receipt(_index)->hash(); };
+    if (!m_receiptsMerkleTree)
+    {
+        m_receiptsMerkleTree = std::make_shared<MerkleTree>(m_receiptFactory->cryptoSuite());
+        m_receiptsMerkleTree->setLeaves(encodeToCalculateRoot(receiptsSize(), hashFunc));
+        m_dirtyReceipts.clear();
+        return m_receiptsMerkleTree;
+    }
+    std::sort(m_dirtyReceipts.begin(), m_dirtyReceipts.end());
+    for (auto index : m_dirtyReceipts)
+    {
+        m_receiptsMerkleTree->setLeaf(index, encodeMerkleLeaf(index, hashFunc(index)));
+    }
+    m_dirtyReceipts.clear();
+    return m_receiptsMerkleTree;
+}
+
+void PBBlock::updateTxsMerkleTree(size_t _index, size_t _oldSize, bool _fromMetaData)
+{
+    std::lock_guard<std::mutex> l(x_txsMerkleTree);
+    if (!m_txsMerkleTree)
+    {
+        return;
+    }
+    if (m_txsMerkleTreeFromMetaData != _fromMetaData)
+    {
+        // the transactions take the place of the transactions metaData
+        if (!_fromMetaData)
+        {
+            m_txsMerkleTree = nullptr;
+            m_dirtyTxs.clear();
+        }
+        return;
+    }
+    // the leaves between _oldSize and _index are empty, rebuild the tree
+    if (_index > _oldSize)
+    {
+        m_txsMerkleTree = nullptr;
+        m_dirtyTxs.clear();
+        return;
+    }
+    m_dirtyTxs.emplace_back(_index);
+}
+
+void PBBlock::updateReceiptsMerkleTree(size_t _index, size_t _oldSize)
+{
+    std::lock_guard<std::mutex> l(x_receiptsMerkleTree);
+    if (!m_receiptsMerkleTree)
+    {
+        return;
+    }
+    if (_index > _oldSize)
+    {
+        m_receiptsMerkleTree = nullptr;
+        m_dirtyReceipts.clear();
+        return;
+    }
+    m_dirtyReceipts.emplace_back(_index);
+}
@@ -23,7 +23,9 @@
 #include "../../interfaces/protocol/Block.h"
 #include "../../interfaces/protocol/BlockHeaderFactory.h"
 #include "../../interfaces/protocol/TransactionMetaData.h"
+#include "../MerkleTree.h"
 #include "libprotocol/bcos-proto/Block.pb.h"
+#include <mutex>
 namespace bcos
 {
 namespace protocol
@@ -71,6 +73,15 @@ public:
     void decode(bytesConstRef _data, bool _calculateHash, bool _checkSig) override;
     void encode(bytes& _encodeData) const override;
 
+    // the merkle trees are cached, only the modified leaves are recalculated
+    bcos::crypto::HashType calculateTransactionRoot() const override;
+    bcos::crypto::HashType calculateReceiptRoot() const override;
+    // the merkle proofs of the given transactions or receipts, built from one merkle tree
+    // Note: the leaf of the proof is encodeMerkleLeaf(index, hash)
+    std::vector<MerkleTree::Proof> transactionsMerkleProof(
+        std::vector<size_t> const& _indexes) const;
+    std::vector<MerkleTree::Proof> receiptsMerkleProof(std::vector<size_t> const& _indexes) const;
+
     // getNonces of the current block
     Transaction::ConstPtr transaction(size_t _index) const override;
     TransactionMetaData::ConstPtr transactionMetaData(size_t _index) const override;
@@ -86,7 +97,11 @@ public:
     BlockHeader::ConstPtr blockHeaderConst() const override { return m_blockHeader; }
     BlockHeader::Ptr blockHeader() override { return m_blockHeader; }
     // get transactions
-    TransactionsConstPtr transactions() const { return m_transactions; }  // removed
+    TransactionsConstPtr transactions() const
+    {
+        decodeAllTransactions();
+        return m_transactions;
+    }  // removed
     // get receipts
     ReceiptsConstPtr receipts() const { return m_receipts; }  // removed
     // get transaction hash
@@ -104,23 +119,30 @@ public:
     // set transactions
     void setTransactions(TransactionsPtr _transactions)  // removed
     {
+        m_lazyTxsFlags.reset();
         m_transactions = _transactions;
         clearTransactionsCache();
+        resetTxsMerkleTree();
     }
     // Note: the caller must ensure the allocated transactions size
     void setTransaction(size_t _index, Transaction::Ptr _transaction) override
     {
-        if (m_transactions->size() <= _index)
+        stopLazyDecodeTransactions();
+        auto transactionsSize = m_transactions->size();
+        if (transactionsSize <= _index)
         {
             m_transactions->resize(_index + 1);
         }
         (*m_transactions)[_index] = _transaction;
         clearTransactionsCache();
+        updateTxsMerkleTree(_index, transactionsSize, false);
     }
     void appendTransaction(Transaction::Ptr _transaction) override
     {
+        stopLazyDecodeTransactions();
         m_transactions->push_back(_transaction);
         clearTransactionsCache();
+        updateTxsMerkleTree(m_transactions->size() - 1, m_transactions->size() - 1, false);
     }
     // set receipts
     void setReceipts(ReceiptsPtr _receipts)  // removed
@@ -128,26 +150,32 @@ public:
         m_receipts = _receipts;
         // clear the cache
         clearReceiptsCache();
+        resetReceiptsMerkleTree();
     }
     // Note: the caller must ensure the allocated receipts size
     void setReceipt(size_t _index, TransactionReceipt::Ptr _receipt) override
     {
-        if (m_receipts->size() <= _index)
+        auto receiptsSize = m_receipts->size();
+        if (receiptsSize <= _index)
         {
             m_receipts->resize(_index + 1);
         }
         (*m_receipts)[_index] = _receipt;
         clearReceiptsCache();
+        updateReceiptsMerkleTree(_index, receiptsSize);
     }
 
     void appendReceipt(TransactionReceipt::Ptr _receipt) override
     {
         m_receipts->push_back(_receipt);
         clearReceiptsCache();
+        updateReceiptsMerkleTree(m_receipts->size() - 1, m_receipts->size() - 1);
     }
     void appendTransactionMetaData(TransactionMetaData::Ptr _txMetaData) override
     {
         m_transactionMetaDataList->emplace_back(_txMetaData);
+        updateTxsMerkleTree(
+            m_transactionMetaDataList->size() - 1, m_transactionMetaDataList->size() - 1, true);
     }
 
     // get transactions size
@@ -169,6 +197,21 @@ public:
     }
     NonceList const& nonceList() const override { return *m_nonceList; }
 
+    // decode the raw messages of the whole block into one protobuf arena
+    void setUseArena(bool _useArena) { m_useArena = _useArena; }
+    bool useArena() const { return m_useArena; }
+
+    // keep the raw transactions when decoding, and decode each of them on first access
+    void setLazyDecodeTransactions(bool _lazyDecodeTransactions)
+    {
+        m_lazyDecodeTransactions = _lazyDecodeTransactions;
+    }
+    bool lazyDecodeTransactions() const { return m_lazyDecodeTransactions; }
+    // decode all the lazily decoded transactions in parallel, e.g. before execution
+    // Note: the signature check failure of the lazily decoded transaction throws here or in
+    // transaction()
+    void decodeAllTransactions() const;
+
 protected:
     virtual void encodeTransactionsMetaData() const;
     virtual void decodeTransactionsMetaData();
@@ -185,26 +228,57 @@ protected:
 
 private:
     void decodeTransactions(bool _calculateHash, bool _checkSig);
+    Transaction::Ptr decodeTransaction(int _index, bool _calculateHash, bool _checkSig) const;
+    void lazyDecodeTransaction(size_t _index) const;
+    // Note: the transactions must not be accessed concurrently when calling this
+    void stopLazyDecodeTransactions()
+    {
+        decodeAllTransactions();
+        m_lazyTxsFlags.reset();
+    }
     void decodeReceipts(bool _calculateHash);
 
     void decodeNonceList();
+    // replace the raw block with a new one allocated on a fresh arena
+    void resetArena(size_t _dataSize);
 
     void encodeTransactions() const;
     void encodeReceipts() const;
 
     void encodeNonceList() const;
 
+    // the decoded transactions borrow their data from the raw transactions of m_pbRawBlock,
+    // move the other fields to a new raw block before modifying the raw transactions
+    void detachRawTransactions();
+
     void clearTransactionsCache()
     {
+        detachRawTransactions();
         m_pbRawBlock->clear_transactions();
-        // WriteGuard l(x_txsRootCache);
-        // m_txsRootCache = bcos::crypto::HashType();
     }
-    void clearReceiptsCache()
+    void clearReceiptsCache() { m_pbRawBlock->clear_receipts(); }
+
+    // mark the _index-th leaf of the cached merkle tree modified, _oldSize is the leaves size
+    // before the modification, _fromMetaData is true if the leaf is a transaction metaData
+    void updateTxsMerkleTree(size_t _index, size_t _oldSize, bool _fromMetaData);
+    void updateReceiptsMerkleTree(size_t _index, size_t _oldSize);
+    // build or update the cached merkle tree, nullptr if there are no leaves
+    // Note: must be called with x_txsMerkleTree or x_receiptsMerkleTree held
+    MerkleTree::Ptr syncTxsMerkleTree() const;
+    MerkleTree::Ptr syncReceiptsMerkleTree() const;
+    std::vector<MerkleTree::Proof> merkleProof(
+        MerkleTree::Ptr _merkleTree, std::vector<size_t> const& _indexes) const;
+    void resetTxsMerkleTree()
+    {
+        std::lock_guard<std::mutex> l(x_txsMerkleTree);
+        m_txsMerkleTree = nullptr;
+        m_dirtyTxs.clear();
+    }
+    void resetReceiptsMerkleTree()
     {
-        m_pbRawBlock->clear_receipts();
-        // WriteGuard l(x_receiptRootCache);
-        // m_receiptRootCache = bcos::crypto::HashType();
+        std::lock_guard<std::mutex> l(x_receiptsMerkleTree);
+        m_receiptsMerkleTree = nullptr;
+        m_dirtyReceipts.clear();
     }
 
 private:
@@ -215,6 +289,31 @@ private:
     ReceiptsPtr m_receipts;
     TransactionMetaDataListPtr m_transactionMetaDataList;
     NonceListPtr m_nonceList;
+
+    bool m_useArena = false;
+    // whether the decoded transactions refer to the raw transactions of m_pbRawBlock
+    bool m_rawTransactionsBorrowed = false;
+
+    bool m_lazyDecodeTransactions = false;
+    // the decode flags of the lazily decoded transactions, nullptr if all have been decoded
+    std::unique_ptr<std::once_flag[]> m_lazyTxsFlags;
+    bool m_lazyCalculateHash = false;
+    bool m_lazyCheckSig = false;
+    // the raw messages of the decoded block, the transactions and the receipts, kept alive by
+    // m_pbRawBlock and the decoded transactions and receipts
+    std::shared_ptr<google::protobuf::Arena> m_arena;
+
+    // the merkle tree of the transactions, or of the transactions metaData if there are no
+    // transactions, nullptr if it should be rebuilt
+    mutable MerkleTree::Ptr m_txsMerkleTree;
+    mutable bool m_txsMerkleTreeFromMetaData = false;
+    // the modified leaves since the last calculateTransactionRoot
+    mutable std::vector<size_t> m_dirtyTxs;
+    mutable std::mutex x_txsMerkleTree;
+
+    mutable MerkleTree::Ptr m_receiptsMerkleTree;
+    mutable std::vector<size_t> m_dirtyReceipts;
+    mutable std::mutex x_receiptsMerkleTree;
 };
 }  // namespace protocol
 }  // namespace bcos
\ No newline at end of file
@@ -51,17 +51,32 @@ public:
     Block::Ptr createBlock(
         bytes const& _data, bool _calculateHash = true, bool _checkSig = true) override
     {
-        return std::make_shared<PBBlock>(m_blockHeaderFactory, m_transactionFactory,
-            m_receiptFactory, _data, _calculateHash, _checkSig);
+        return createBlock(ref(_data), _calculateHash, _checkSig);
     }
 
     Block::Ptr createBlock(
         bytesConstRef _data, bool _calculateHash = true, bool _checkSig = true) override
     {
-        return std::make_shared<PBBlock>(m_blockHeaderFactory, m_transactionFactory,
-            m_receiptFactory, _data, _calculateHash, _checkSig);
+        auto block =
+            std::make_shared<PBBlock>(m_blockHeaderFactory, m_transactionFactory, m_receiptFactory);
+        block->setUseArena(m_useArena);
+        block->setLazyDecodeTransactions(m_lazyDecodeTransactions);
+        block->decode(_data, _calculateHash, _checkSig);
+        return block;
     }
 
+    // decode the raw messages of each block into one protobuf arena to reduce the allocations
+    void setUseArena(bool _useArena) { m_useArena = _useArena; }
+    bool useArena() const { return m_useArena; }
+
+    // decode the transactions of each block on first access, for the blocks that are only
+    // forwarded or whose transactions are rarely touched
+    void setLazyDecodeTransactions(bool _lazyDecodeTransactions)
+    {
+        m_lazyDecodeTransactions = _lazyDecodeTransactions;
+    }
+    bool lazyDecodeTransactions() const { return m_lazyDecodeTransactions; }
+
     TransactionMetaData::Ptr createTransactionMetaData() override
     {
         return std::make_shared<PBTransactionMetaData>();
@@ -85,6 +100,8 @@ private:
     BlockHeaderFactory::Ptr m_blockHeaderFactory;
     TransactionFactory::Ptr m_transactionFactory;
     TransactionReceiptFactory::Ptr m_receiptFactory;
+    bool m_useArena = false;
+    bool m_lazyDecodeTransactions = false;
 };
 }  // namespace protocol
 }  // namespace bcos
\ No newline at end of file
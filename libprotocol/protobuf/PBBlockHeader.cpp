@@ -57,11 +57,14 @@ void PBBlockHeader::encodeHashFields() const
     {
         return;
     }
-    ScaleEncoderStream stream;
+    // encode into the hashFieldsData allocated once with the exact encoded size
+    auto hashFieldsData = m_blockHeader->mutable_hashfieldsdata();
+    hashFieldsData->resize(scaleEncodedSize(m_parentInfo, m_txsRoot, m_receiptsRoot, m_stateRoot,
+        m_number, m_gasUsed, m_timestamp, m_sealer, m_sealerList, m_consensusWeights,
+        m_extraData));
+    ScaleEncoderStream stream((byte*)hashFieldsData->data(), hashFieldsData->size());
     stream << m_parentInfo << m_txsRoot << m_receiptsRoot << m_stateRoot << m_number << m_gasUsed
            << m_timestamp << m_sealer << m_sealerList << m_consensusWeights << m_extraData;
-    auto hashFieldsData = stream.data();
-    m_blockHeader->set_hashfieldsdata(hashFieldsData.data(), hashFieldsData.size());
 }
 
 void PBBlockHeader::encodeSignatureList() const
@@ -95,6 +98,13 @@ void PBBlockHeader::encode(bytes& _encodedData) const
     encodePBObject(_encodedData, m_blockHeader);
 }
 
+void PBBlockHeader::encode(std::string& _encodedData) const
+{
+    encodeHashFields();
+    encodeSignatureList();
+    encodePBObject(_encodedData, m_blockHeader);
+}
+
 void PBBlockHeader::clear()
 {
     m_blockHeader->clear_hashfieldsdata();
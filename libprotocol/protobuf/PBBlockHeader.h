@@ -51,6 +51,8 @@ public:
 
     void decode(bytesConstRef _data) override;
     void encode(bytes& _encodeData) const override;
+    // encode into the protobuf-owned string to avoid copy
+    void encode(std::string& _encodeData) const;
     bcos::crypto::HashType hash() const override
     {
         encodeHashFields();
@@ -0,0 +1,484 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief encode and decode the block in the PBRawBlock format chunk by chunk
+ * @file PBBlockStreamCodec.cpp
+ * @author: yujiechen
+ * @date: 2021-10-18
+ */
+#include "PBBlockStreamCodec.h"
+#include "../../interfaces/protocol/Exceptions.h"
+#include "../Common.h"
+#include "PBTransactionFactory.h"
+#include "PBTransactionMetaData.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <tbb/parallel_for.h>
+
+using namespace bcos;
+using namespace bcos::protocol;
+using namespace bcos::crypto;
+using WireFormatLite = google::protobuf::internal::WireFormatLite;
+
+namespace
+{
+// the field numbers of PBRawBlock
+struct RawBlockFieldNumbers
+{
+    int version;
+    int type;
+    int header;
+    int transactions;
+    int receipts;
+    int transactionsMetaData;
+    int nonceList;
+};
+
+RawBlockFieldNumbers const& rawBlockFieldNumbers()
+{
+    static RawBlockFieldNumbers const fieldNumbers = []() {
+        auto blockDescriptor = PBRawBlock::descriptor();
+        RawBlockFieldNumbers numbers;
+        numbers.version = pbFieldNumber(blockDescriptor, "version");
+        numbers.type = pbFieldNumber(blockDescriptor, "type");
+        numbers.header = pbFieldNumber(blockDescriptor, "header");
+        numbers.transactions = pbFieldNumber(blockDescriptor, "transactions");
+        numbers.receipts = pbFieldNumber(blockDescriptor, "receipts");
+        numbers.transactionsMetaData = pbFieldNumber(blockDescriptor, "transactionsmetadata");
+        numbers.nonceList = pbFieldNumber(blockDescriptor, "noncelist");
+        return numbers;
+    }();
+    return fieldNumbers;
+}
+
+// buffer the small fields and pass the data to the sink at most _chunkSize at once
+class ChunkWriter
+{
+public:
+    ChunkWriter(BlockDataSink const& _sink, size_t _chunkSize)
+      : m_sink(_sink), m_chunkSize(_chunkSize)
+    {
+        m_buffer.reserve(_chunkSize);
+    }
+
+    void writeVarintField(int _fieldNumber, uint64_t _value)
+    {
+        writeVarint(WireFormatLite::MakeTag(_fieldNumber, WireFormatLite::WIRETYPE_VARINT));
+        writeVarint(_value);
+    }
+
+    void writeBytesField(int _fieldNumber, bytesConstRef _data)
+    {
+        writeVarint(
+            WireFormatLite::MakeTag(_fieldNumber, WireFormatLite::WIRETYPE_LENGTH_DELIMITED));
+        writeVarint(_data.size());
+        write(_data);
+    }
+
+    void flush()
+    {
+        if (m_buffer.empty())
+        {
+            return;
+        }
+        m_sink(ref(m_buffer));
+        m_buffer.clear();
+    }
+
+private:
+    void writeVarint(uint64_t _value)
+    {
+        // the varint64 takes at most 10 bytes
+        byte data[10];
+        auto end = google::protobuf::io::CodedOutputStream::WriteVarint64ToArray(_value, data);
+        write(bytesConstRef(data, end - data));
+    }
+
+    void write(bytesConstRef _data)
+    {
+        if (m_buffer.size() + _data.size() > m_chunkSize)
+        {
+            flush();
+        }
+        // the large field is passed to the sink without copy
+        if (_data.size() >= m_chunkSize)
+        {
+            m_sink(_data);
+            return;
+        }
+        m_buffer.insert(m_buffer.end(), _data.begin(), _data.end());
+    }
+
+    BlockDataSink const& m_sink;
+    size_t m_chunkSize;
+    bytes m_buffer;
+};
+
+// read the data from the source _chunkSize at once
+class ChunkReader
+{
+public:
+    ChunkReader(BlockDataSource const& _source, size_t _chunkSize)
+      : m_source(_source), m_buffer(_chunkSize)
+    {}
+
+    // return false at the end of the data
+    bool readTag(uint32_t& _tag)
+    {
+        if (!fill())
+        {
+            return false;
+        }
+        _tag = (uint32_t)readVarint();
+        return true;
+    }
+
+    uint64_t readVarint()
+    {
+        uint64_t value = 0;
+        for (size_t shift = 0; shift < 64; shift += 7)
+        {
+            if (!fill())
+            {
+                throwTruncated();
+            }
+            auto data = m_buffer[m_offset++];
+            value |= (uint64_t)(data & 0x7f) << shift;
+            if ((data & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+        BOOST_THROW_EXCEPTION(
+            PBObjectDecodeException() << errinfo_comment("PBBlockStreamCodec: invalid varint"));
+    }
+
+    // Note: _data grows with the read data, so that a corrupted size does not allocate at once
+    void read(bytes& _data, size_t _size)
+    {
+        _data.clear();
+        while (_data.size() < _size)
+        {
+            auto remaining = _size - _data.size();
+            if (m_offset < m_end)
+            {
+                auto size = std::min(remaining, m_end - m_offset);
+                _data.insert(_data.end(), m_buffer.begin() + m_offset,
+                    m_buffer.begin() + m_offset + size);
+                m_offset += size;
+                continue;
+            }
+            // read the large field from the source directly
+            if (remaining >= m_buffer.size())
+            {
+                auto offset = _data.size();
+                _data.resize(offset + m_buffer.size());
+                auto size = m_source(_data.data() + offset, m_buffer.size());
+                _data.resize(offset + size);
+                if (size == 0)
+                {
+                    throwTruncated();
+                }
+                continue;
+            }
+            if (!fill())
+            {
+                throwTruncated();
+            }
+        }
+    }
+
+    void skip(size_t _size)
+    {
+        while (_size > 0)
+        {
+            if (!fill())
+            {
+                throwTruncated();
+            }
+            auto size = std::min(_size, m_end - m_offset);
+            m_offset += size;
+            _size -= size;
+        }
+    }
+
+private:
+    bool fill()
+    {
+        if (m_offset < m_end)
+        {
+            return true;
+        }
+        m_offset = 0;
+        m_end = m_source(m_buffer.data(), m_buffer.size());
+        return m_end > 0;
+    }
+
+    void throwTruncated()
+    {
+        BOOST_THROW_EXCEPTION(
+            PBObjectDecodeException() << errinfo_comment("PBBlockStreamCodec: truncated data"));
+    }
+
+    BlockDataSource const& m_source;
+    bytes m_buffer;
+    size_t m_offset = 0;
+    size_t m_end = 0;
+};
+
+// encode the _size items _batchSize at once in parallel, and write them in order
+template <typename T>
+void writeInBatches(ChunkWriter& _writer, int _fieldNumber, size_t _size, size_t _batchSize,
+    std::vector<bytes>& _buffers, T _encode)
+{
+    std::vector<bytesConstRef> encodedDataList;
+    for (size_t begin = 0; begin < _size; begin += _batchSize)
+    {
+        auto end = std::min(begin + _batchSize, _size);
+        encodedDataList.resize(end - begin);
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(begin, end), [&](const tbb::blocked_range<size_t>& _r) {
+                for (auto i = _r.begin(); i < _r.end(); i++)
+                {
+                    encodedDataList[i - begin] = _encode(i, _buffers[i - begin]);
+                }
+            });
+        for (auto const& encodedData : encodedDataList)
+        {
+            _writer.writeBytesField(_fieldNumber, encodedData);
+        }
+    }
+}
+}  // namespace
+
+void PBBlockStreamCodec::encode(Block::ConstPtr _block, BlockDataSink const& _sink) const
+{
+    auto const& fieldNumbers = rawBlockFieldNumbers();
+    ChunkWriter writer(_sink, m_chunkSize);
+    // write the fields in the order of the field numbers as protobuf does, and omit the default
+    // values as proto3 does
+    if (_block->version() != 0)
+    {
+        writer.writeVarintField(fieldNumbers.version, (uint64_t)(int64_t)_block->version());
+    }
+    if ((int32_t)_block->blockType() != 0)
+    {
+        writer.writeVarintField(fieldNumbers.type, (uint64_t)(int64_t)_block->blockType());
+    }
+    auto blockHeader = _block->blockHeaderConst();
+    if (blockHeader)
+    {
+        bytes headerData;
+        blockHeader->encode(headerData);
+        if (!headerData.empty())
+        {
+            writer.writeBytesField(fieldNumbers.header, ref(headerData));
+        }
+    }
+    // the buffers of the receipts encoded in parallel
+    std::vector<bytes> buffers(m_batchSize);
+    writeInBatches(writer, fieldNumbers.transactions, _block->transactionsSize(), m_batchSize,
+        buffers, [&_block](size_t _index, bytes&) {
+            // the encoded transaction is cached by the transaction
+            return _block->transaction(_index)->encode(false);
+        });
+    writeInBatches(writer, fieldNumbers.receipts, _block->receiptsSize(), m_batchSize, buffers,
+        [&_block](size_t _index, bytes& _buffer) {
+            _block->receipt(_index)->encode(_buffer);
+            return ref(_buffer);
+        });
+    std::string metaData;
+    for (size_t i = 0; i < _block->transactionsMetaDataSize(); i++)
+    {
+        auto txMetaData = std::dynamic_pointer_cast<PBTransactionMetaData>(
+            std::const_pointer_cast<TransactionMetaData>(_block->transactionMetaData(i)));
+        if (!txMetaData)
+        {
+            BOOST_THROW_EXCEPTION(PBObjectEncodeException() << errinfo_comment(
+                                      "PBBlockStreamCodec: unsupported transaction metaData"));
+        }
+        txMetaData->pbTxMetaData()->SerializeToString(&metaData);
+        writer.writeBytesField(fieldNumbers.transactionsMetaData,
+            bytesConstRef((byte const*)metaData.data(), metaData.size()));
+    }
+    auto const& nonceList = _block->nonceList();
+    bytes noncesData(nonceList.size() * 32);
+    u256sToBigEndian(nonceList, noncesData.data());
+    for (size_t i = 0; i < nonceList.size(); i++)
+    {
+        writer.writeBytesField(
+            fieldNumbers.nonceList, bytesConstRef(noncesData.data() + i * 32, 32));
+    }
+    writer.flush();
+}
+
+Block::Ptr PBBlockStreamCodec::decode(
+    BlockDataSource const& _source, bool _calculateHash, bool _checkSig) const
+{
+    auto const& fieldNumbers = rawBlockFieldNumbers();
+    auto block = m_blockFactory->createBlock();
+    auto transactionFactory = m_blockFactory->transactionFactory();
+    auto pbTxFactory = std::dynamic_pointer_cast<PBTransactionFactory>(transactionFactory);
+    auto receiptFactory = m_blockFactory->receiptFactory();
+
+    // the transactions and receipts are decoded _batchSize at once in parallel
+    std::vector<std::shared_ptr<bytes>> pendingTxs;
+    std::vector<bytes> pendingReceipts;
+    auto decodePendingTxs = [&]() {
+        Transactions transactions(pendingTxs.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, pendingTxs.size()),
+            [&](const tbb::blocked_range<size_t>& _r) {
+                for (auto i = _r.begin(); i < _r.end(); i++)
+                {
+                    auto const& txData = pendingTxs[i];
+                    // the transaction takes the ownership of the read data
+                    transactions[i] =
+                        pbTxFactory ?
+                            pbTxFactory->createTransaction(ref(*txData), txData, false) :
+                            transactionFactory->createTransaction(ref(*txData), false);
+                    if (_calculateHash)
+                    {
+                        transactions[i]->hash();
+                    }
+                }
+            });
+        if (_checkSig)
+        {
+            auto invalidIndexes =
+                verifyTransactions(transactionFactory->cryptoSuite(), transactions);
+            if (!invalidIndexes.empty())
+            {
+                BOOST_THROW_EXCEPTION(InvalidTransaction() << errinfo_comment(
+                                          "invalid transaction, index: " +
+                                          std::to_string(block->transactionsSize() +
+                                                         invalidIndexes[0])));
+            }
+        }
+        for (auto& transaction : transactions)
+        {
+            block->appendTransaction(transaction);
+        }
+        pendingTxs.clear();
+    };
+    auto decodePendingReceipts = [&]() {
+        Receipts receipts(pendingReceipts.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, pendingReceipts.size()),
+            [&](const tbb::blocked_range<size_t>& _r) {
+                for (auto i = _r.begin(); i < _r.end(); i++)
+                {
+                    receipts[i] = receiptFactory->createReceipt(ref(pendingReceipts[i]));
+                    if (_calculateHash)
+                    {
+                        receipts[i]->hash();
+                    }
+                }
+            });
+        for (auto& receipt : receipts)
+        {
+            block->appendReceipt(receipt);
+        }
+        pendingReceipts.clear();
+    };
+
+    ChunkReader reader(_source, m_chunkSize);
+    NonceList nonceList;
+    bytes fieldData;
+    uint32_t tag;
+    while (reader.readTag(tag))
+    {
+        auto fieldNumber = WireFormatLite::GetTagFieldNumber(tag);
+        auto wireType = WireFormatLite::GetTagWireType(tag);
+        if (wireType == WireFormatLite::WIRETYPE_VARINT)
+        {
+            auto value = reader.readVarint();
+            if (fieldNumber == fieldNumbers.version)
+            {
+                block->setVersion((int32_t)value);
+            }
+            else if (fieldNumber == fieldNumbers.type)
+            {
+                block->setBlockType((BlockType)(int32_t)value);
+            }
+            continue;
+        }
+        if (wireType == WireFormatLite::WIRETYPE_FIXED64)
+        {
+            reader.skip(8);
+            continue;
+        }
+        if (wireType == WireFormatLite::WIRETYPE_FIXED32)
+        {
+            reader.skip(4);
+            continue;
+        }
+        if (wireType != WireFormatLite::WIRETYPE_LENGTH_DELIMITED)
+        {
+            BOOST_THROW_EXCEPTION(PBObjectDecodeException() << errinfo_comment(
+                                      "PBBlockStreamCodec: unsupported wire type " +
+                                      std::to_string(wireType)));
+        }
+        auto size = reader.readVarint();
+        if (fieldNumber == fieldNumbers.transactions)
+        {
+            auto txData = std::make_shared<bytes>();
+            reader.read(*txData, size);
+            pendingTxs.emplace_back(std::move(txData));
+            if (pendingTxs.size() >= m_batchSize)
+            {
+                decodePendingTxs();
+            }
+            continue;
+        }
+        if (fieldNumber == fieldNumbers.receipts)
+        {
+            pendingReceipts.emplace_back();
+            reader.read(pendingReceipts.back(), size);
+            if (pendingReceipts.size() >= m_batchSize)
+            {
+                decodePendingReceipts();
+            }
+            continue;
+        }
+        if (fieldNumber != fieldNumbers.header && fieldNumber != fieldNumbers.nonceList &&
+            fieldNumber != fieldNumbers.transactionsMetaData)
+        {
+            reader.skip(size);
+            continue;
+        }
+        reader.read(fieldData, size);
+        if (fieldNumber == fieldNumbers.header)
+        {
+            block->setBlockHeader(
+                m_blockFactory->blockHeaderFactory()->createBlockHeader(ref(fieldData)));
+        }
+        else if (fieldNumber == fieldNumbers.nonceList)
+        {
+            nonceList.emplace_back(fromBigEndian<u256>(ref(fieldData)));
+        }
+        else
+        {
+            auto pbTxMetaData = std::make_shared<PBRawTransactionMetaData>();
+            decodePBObject(pbTxMetaData, ref(fieldData));
+            block->appendTransactionMetaData(std::make_shared<PBTransactionMetaData>(pbTxMetaData));
+        }
+    }
+    decodePendingTxs();
+    decodePendingReceipts();
+    if (!nonceList.empty())
+    {
+        block->setNonceList(std::move(nonceList));
+    }
+    return block;
+}
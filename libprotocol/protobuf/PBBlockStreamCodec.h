@@ -0,0 +1,60 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief encode and decode the block in the PBRawBlock format chunk by chunk
+ * @file PBBlockStreamCodec.h
+ * @author: yujiechen
+ * @date: 2021-10-18
+ */
+#pragma once
+#include "../../interfaces/protocol/BlockFactory.h"
+#include <functional>
+
+namespace bcos
+{
+namespace protocol
+{
+// receive the next chunk of the encoded block, e.g. write it into a file or a socket buffer
+using BlockDataSink = std::function<void(bytesConstRef _chunk)>;
+// read at most _size bytes into _buffer, return the read size, 0 at the end of the data
+using BlockDataSource = std::function<size_t(byte* _buffer, size_t _size)>;
+
+// PBBlockStreamCodec produces the same data as PBBlock::encode without holding the whole
+// encoded block or a second copy of the transactions and receipts in memory
+class PBBlockStreamCodec
+{
+public:
+    using Ptr = std::shared_ptr<PBBlockStreamCodec>;
+    // _chunkSize: the size of the data passed to the sink or read from the source at once
+    // _batchSize: the transactions or receipts encoded or decoded in parallel at once
+    explicit PBBlockStreamCodec(BlockFactory::Ptr _blockFactory, size_t _chunkSize = 1024 * 1024,
+        size_t _batchSize = 1000)
+      : m_blockFactory(_blockFactory), m_chunkSize(_chunkSize), m_batchSize(_batchSize)
+    {
+        assert(m_chunkSize > 0 && m_batchSize > 0);
+    }
+    virtual ~PBBlockStreamCodec() {}
+
+    virtual void encode(Block::ConstPtr _block, BlockDataSink const& _sink) const;
+    virtual Block::Ptr decode(
+        BlockDataSource const& _source, bool _calculateHash = true, bool _checkSig = true) const;
+
+private:
+    BlockFactory::Ptr m_blockFactory;
+    size_t m_chunkSize;
+    size_t m_batchSize;
+};
+}  // namespace protocol
+}  // namespace bcos
@@ -21,10 +21,122 @@
 #include "PBTransaction.h"
 #include "../../interfaces/protocol/Exceptions.h"
 #include "../Common.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
 
 using namespace bcos;
 using namespace bcos::protocol;
 using namespace bcos::crypto;
+using WireFormatLite = google::protobuf::internal::WireFormatLite;
+
+namespace
+{
+// the field numbers of PBRawTransaction and PBRawTransactionHashFields
+struct RawTransactionFieldNumbers
+{
+    int hashFieldsData;
+    int hashFieldsHash;
+    int signatureData;
+    int importTime;
+    int attribute;
+    int source;
+
+    int version;
+    int chainId;
+    int groupId;
+    int blockLimit;
+    int nonce;
+    int to;
+    int input;
+};
+
+RawTransactionFieldNumbers const& rawTransactionFieldNumbers()
+{
+    static RawTransactionFieldNumbers const fieldNumbers = []() {
+        auto txDescriptor = PBRawTransaction::descriptor();
+        auto hashFieldsDescriptor = PBRawTransactionHashFields::descriptor();
+        RawTransactionFieldNumbers numbers;
+        numbers.hashFieldsData = pbFieldNumber(txDescriptor, "hashfieldsdata");
+        numbers.hashFieldsHash = pbFieldNumber(txDescriptor, "hashfieldshash");
+        numbers.signatureData = pbFieldNumber(txDescriptor, "signaturedata");
+        numbers.importTime = pbFieldNumber(txDescriptor, "import_time");
+        numbers.attribute = pbFieldNumber(txDescriptor, "attribute");
+        numbers.source = pbFieldNumber(txDescriptor, "source");
+        numbers.version = pbFieldNumber(hashFieldsDescriptor, "version");
+        numbers.chainId = pbFieldNumber(hashFieldsDescriptor, "chainid");
+        numbers.groupId = pbFieldNumber(hashFieldsDescriptor, "groupid");
+        numbers.blockLimit = pbFieldNumber(hashFieldsDescriptor, "blocklimit");
+        numbers.nonce = pbFieldNumber(hashFieldsDescriptor, "nonce");
+        numbers.to = pbFieldNumber(hashFieldsDescriptor, "to");
+        numbers.input = pbFieldNumber(hashFieldsDescriptor, "input");
+        return numbers;
+    }();
+    return fieldNumbers;
+}
+
+// iterate the varint and length-delimited fields of the serialized message without copy,
+// the fields of the other wire types are skipped
+template <typename F>
+void forEachRawField(bytesConstRef _data, F _onField)
+{
+    google::protobuf::io::CodedInputStream input(_data.data(), _data.size());
+    while (true)
+    {
+        auto tag = input.ReadTag();
+        if (tag == 0)
+        {
+            // the tag 0 is invalid, except for the end of the data
+            if (input.CurrentPosition() == (int)_data.size())
+            {
+                return;
+            }
+            break;
+        }
+        auto fieldNumber = WireFormatLite::GetTagFieldNumber(tag);
+        auto wireType = WireFormatLite::GetTagWireType(tag);
+        if (wireType == WireFormatLite::WIRETYPE_VARINT)
+        {
+            uint64_t value;
+            if (!input.ReadVarint64(&value))
+            {
+                break;
+            }
+            _onField(fieldNumber, wireType, value, bytesConstRef());
+            continue;
+        }
+        if (wireType == WireFormatLite::WIRETYPE_LENGTH_DELIMITED)
+        {
+            uint32_t length;
+            if (!input.ReadVarint32(&length))
+            {
+                break;
+            }
+            auto offset = (size_t)input.CurrentPosition();
+            if (length > _data.size() - offset || !input.Skip(length))
+            {
+                break;
+            }
+            _onField(fieldNumber, wireType, 0, bytesConstRef(_data.data() + offset, length));
+            continue;
+        }
+        // the groups are not used by the transaction
+        if (wireType == WireFormatLite::WIRETYPE_START_GROUP ||
+            wireType == WireFormatLite::WIRETYPE_END_GROUP ||
+            !WireFormatLite::SkipField(&input, tag))
+        {
+            break;
+        }
+    }
+    BOOST_THROW_EXCEPTION(
+        PBObjectDecodeException() << errinfo_comment(
+            "decode bytes data into PBObject failed, data: " + *toHexString(_data)));
+}
+
+inline std::string_view toStringView(bytesConstRef _data)
+{
+    return std::string_view((char const*)_data.data(), _data.size());
+}
+}  // namespace
 
 PBTransaction::PBTransaction(bcos::crypto::CryptoSuite::Ptr _cryptoSuite, int32_t _version,
     const std::string_view& _to, bytes const& _input, u256 const& _nonce, int64_t _blockLimit,
@@ -41,7 +153,8 @@ PBTransaction::PBTransaction(bcos::crypto::CryptoSuite::Ptr _cryptoSuite, int32_
     m_transactionHashFields->set_input(_input.data(), _input.size());
     // set nonce
     m_nonce = _nonce;
-    bytes nonceBytes = toBigEndian(_nonce);
+    std::array<byte, 32> nonceBytes;
+    u256ToBigEndian(_nonce, nonceBytes.data());
     m_transactionHashFields->set_nonce(nonceBytes.data(), nonceBytes.size());
     // set block limit
     m_transactionHashFields->set_blocklimit(_blockLimit);
@@ -69,19 +182,114 @@ PBTransaction::PBTransaction(CryptoSuite::Ptr _cryptoSuite, bytesConstRef _txDat
     }
 }
 
+PBTransaction::PBTransaction(CryptoSuite::Ptr _cryptoSuite, bytesConstRef _txData,
+    std::shared_ptr<const void> _txDataOwner, bool _checkSig)
+  : PBTransaction(_cryptoSuite)
+{
+    decode(_txData, _txDataOwner);
+    if (_checkSig)
+    {
+        verify();
+    }
+}
+
 void PBTransaction::decode(bytesConstRef _txData)
 {
-    // cache data into dataCache
-    *m_dataCache = _txData.toBytes();
+    auto txData = std::make_shared<bytes>(_txData.toBytes());
+    decode(ref(*txData), txData);
+}
+
+void PBTransaction::decode(bytesConstRef _txData, std::shared_ptr<const void> _txDataOwner)
+{
+    auto const& fieldNumbers = rawTransactionFieldNumbers();
+    RawFields rawFields;
     // decode transaction
-    decodePBObject(m_transaction, _txData);
+    forEachRawField(_txData, [&](int _fieldNumber, WireFormatLite::WireType _wireType,
+                                 uint64_t _value, bytesConstRef _data) {
+        if (_wireType == WireFormatLite::WIRETYPE_VARINT)
+        {
+            if (_fieldNumber == fieldNumbers.importTime)
+            {
+                rawFields.importTime = (int64_t)_value;
+            }
+            else if (_fieldNumber == fieldNumbers.attribute)
+            {
+                rawFields.attribute = (uint32_t)_value;
+            }
+            return;
+        }
+        if (_fieldNumber == fieldNumbers.hashFieldsData)
+        {
+            rawFields.hashFieldsData = _data;
+        }
+        else if (_fieldNumber == fieldNumbers.hashFieldsHash)
+        {
+            rawFields.hashFieldsHash = _data;
+        }
+        else if (_fieldNumber == fieldNumbers.signatureData)
+        {
+            rawFields.signatureData = _data;
+        }
+        else if (_fieldNumber == fieldNumbers.source)
+        {
+            rawFields.source = toStringView(_data);
+        }
+    });
     // decode transactionHashFields
-    auto transactionHashFields = m_transaction->mutable_hashfieldsdata();
-    decodePBObject(m_transactionHashFields,
-        bytesConstRef((byte const*)transactionHashFields->c_str(), transactionHashFields->size()));
-    m_nonce =
-        fromBigEndian<u256>(bytesConstRef((const byte*)m_transactionHashFields->nonce().data(),
-            m_transactionHashFields->nonce().size()));
+    forEachRawField(rawFields.hashFieldsData, [&](int _fieldNumber,
+                                                  WireFormatLite::WireType _wireType,
+                                                  uint64_t _value, bytesConstRef _data) {
+        if (_wireType == WireFormatLite::WIRETYPE_VARINT)
+        {
+            if (_fieldNumber == fieldNumbers.version)
+            {
+                rawFields.version = (int32_t)_value;
+            }
+            else if (_fieldNumber == fieldNumbers.blockLimit)
+            {
+                rawFields.blockLimit = (int64_t)_value;
+            }
+            return;
+        }
+        if (_fieldNumber == fieldNumbers.chainId)
+        {
+            rawFields.chainId = toStringView(_data);
+        }
+        else if (_fieldNumber == fieldNumbers.groupId)
+        {
+            rawFields.groupId = toStringView(_data);
+        }
+        else if (_fieldNumber == fieldNumbers.nonce)
+        {
+            rawFields.nonce = _data;
+        }
+        else if (_fieldNumber == fieldNumbers.to)
+        {
+            rawFields.to = toStringView(_data);
+        }
+        else if (_fieldNumber == fieldNumbers.input)
+        {
+            rawFields.input = _data;
+        }
+    });
+    m_rawFields = rawFields;
+    m_rawData = _txData;
+    m_rawDataOwner = _txDataOwner;
+    m_dataCache->clear();
+    m_nonce = fromBigEndian<u256>(m_rawFields.nonce);
+}
+
+void PBTransaction::detachRawData()
+{
+    if (!m_rawDataOwner)
+    {
+        return;
+    }
+    decodePBObject(m_transaction, m_rawData);
+    decodePBObject(m_transactionHashFields, m_rawFields.hashFieldsData);
+    m_rawDataOwner.reset();
+    m_rawData = bytesConstRef();
+    m_rawFields = RawFields();
 }
 
 void PBTransaction::encode(bytes& _encodedData) const
@@ -91,6 +299,10 @@ void PBTransaction::encode(bytes& _encodedData) const
 
 bytesConstRef PBTransaction::encode(bool _onlyHashFields) const
 {
+    if (m_rawDataOwner)
+    {
+        return _onlyHashFields ? m_rawFields.hashFieldsData : m_rawData;
+    }
     if (_onlyHashFields)
     {
         auto const& hashFieldData = m_transaction->hashfieldsdata();
@@ -105,12 +317,22 @@ bytesConstRef PBTransaction::encode(bool _onlyHashFields) const
 
 bcos::crypto::HashType PBTransaction::hash() const
 {
+    if (m_rawDataOwner)
+    {
+        if (m_rawFields.hashFieldsHash.size() < bcos::crypto::HashType::size)
+        {
+            return bcos::crypto::HashType();
+        }
+        return bcos::crypto::HashType(
+            m_rawFields.hashFieldsHash.data(), bcos::crypto::HashType::size);
+    }
     return *(
         reinterpret_cast<const bcos::crypto::HashType*>(m_transaction->hashfieldshash().data()));
 }
 
 void PBTransaction::updateSignature(bytesConstRef _signatureData, bytes const& _sender)
 {
+    detachRawData();
     m_transaction->set_signaturedata(_signatureData.data(), _signatureData.size());
     m_sender = _sender;
     m_dataCache->clear();
@@ -118,6 +340,10 @@ void PBTransaction::updateSignature(bytesConstRef _signatureData, bytes const& _
 
 bytesConstRef PBTransaction::input() const
 {
+    if (m_rawDataOwner)
+    {
+        return m_rawFields.input;
+    }
     auto const& inputData = m_transactionHashFields->input();
     return bytesConstRef((byte const*)(inputData.data()), inputData.size());
 }
\ No newline at end of file
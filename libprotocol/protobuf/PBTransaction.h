@@ -24,6 +24,7 @@
 #include "../../libutilities/Common.h"
 #include "../../libutilities/FixedBytes.h"
 #include "../../libutilities/RefDataContainer.h"
+#include "../Common.h"
 #include "libprotocol/bcos-proto/Transaction.pb.h"
 
 namespace bcos
@@ -44,6 +45,9 @@ public:
         bcos::crypto::CryptoSuite::Ptr _cryptoSuite, bytes const& _txData, bool _checkSig)
       : PBTransaction(_cryptoSuite, &_txData, _checkSig)
     {}
+    // decode the transaction without copy, _txData must be kept valid by _txDataOwner
+    PBTransaction(bcos::crypto::CryptoSuite::Ptr _cryptoSuite, bytesConstRef _txData,
+        std::shared_ptr<const void> _txDataOwner, bool _checkSig);
 
     ~PBTransaction() override {}
 
@@ -53,27 +57,53 @@ public:
                (hash() == _comparedTx.hash());
     }
 
+    // Note: copy _txData once into a buffer owned by the transaction
     void decode(bytesConstRef _txData) override;
+    // borrow the fields from _txData, which must be kept valid by _txDataOwner
+    void decode(bytesConstRef _txData, std::shared_ptr<const void> _txDataOwner);
     bytesConstRef encode(bool _onlyHashFields = false) const override;
     bytes takeEncoded() override { return bytes(); };  // FIXME: no impl!
 
     bcos::crypto::HashType hash() const override;
 
     u256 nonce() const override { return m_nonce; }
-    int32_t version() const override { return m_transactionHashFields->version(); }
-    std::string_view chainId() const override { return m_transactionHashFields->chainid(); }
-    std::string_view groupId() const override { return m_transactionHashFields->groupid(); }
-    int64_t blockLimit() const override { return m_transactionHashFields->blocklimit(); }
-    std::string_view to() const override { return m_transactionHashFields->to(); }
+    int32_t version() const override
+    {
+        return m_rawDataOwner ? m_rawFields.version : m_transactionHashFields->version();
+    }
+    std::string_view chainId() const override
+    {
+        return m_rawDataOwner ? m_rawFields.chainId : m_transactionHashFields->chainid();
+    }
+    std::string_view groupId() const override
+    {
+        return m_rawDataOwner ? m_rawFields.groupId : m_transactionHashFields->groupid();
+    }
+    int64_t blockLimit() const override
+    {
+        return m_rawDataOwner ? m_rawFields.blockLimit : m_transactionHashFields->blocklimit();
+    }
+    std::string_view to() const override
+    {
+        return m_rawDataOwner ? m_rawFields.to : m_transactionHashFields->to();
+    }
 
     bytesConstRef input() const override;
-    int64_t importTime() const override { return m_transaction->import_time(); }
+    int64_t importTime() const override
+    {
+        return m_rawDataOwner ? m_rawFields.importTime : m_transaction->import_time();
+    }
     void setImportTime(int64_t _importTime) override
     {
+        detachRawData();
         m_transaction->set_import_time(_importTime);
     }
     bytesConstRef signatureData() const override
     {
+        if (m_rawDataOwner)
+        {
+            return m_rawFields.signatureData;
+        }
         return bytesConstRef((const byte*)m_transaction->signaturedata().data(),
             m_transaction->signaturedata().size());
     }
@@ -81,11 +111,25 @@ public:
     // only for ut
     void updateSignature(bytesConstRef _signatureData, bytes const& _sender);
 
-    uint32_t attribute() const override { return m_transaction->attribute(); }
-    void setAttribute(uint32_t _attribute) override { m_transaction->set_attribute(_attribute); }
+    uint32_t attribute() const override
+    {
+        return m_rawDataOwner ? m_rawFields.attribute : m_transaction->attribute();
+    }
+    void setAttribute(uint32_t _attribute) override
+    {
+        detachRawData();
+        m_transaction->set_attribute(_attribute);
+    }
 
-    std::string_view source() const override { return m_transaction->source(); }
-    void setSource(std::string const& _source) override { m_transaction->set_source(_source); }
+    std::string_view source() const override
+    {
+        return m_rawDataOwner ? m_rawFields.source : m_transaction->source();
+    }
+    void setSource(std::string const& _source) override
+    {
+        detachRawData();
+        m_transaction->set_source(_source);
+    }
 
 protected:
     explicit PBTransaction(bcos::crypto::CryptoSuite::Ptr _cryptoSuite)
@@ -99,11 +143,36 @@ protected:
 
 private:
     void encode(bytes& _encodedData) const;
+    // copy the borrowed fields into the protobuf objects before modifying the transaction
+    void detachRawData();
 
     std::shared_ptr<PBRawTransaction> m_transaction;
     std::shared_ptr<PBRawTransactionHashFields> m_transactionHashFields;
     bytesPointer m_dataCache;
 
+    // the fields of the transaction decoded without copy, refer to m_rawData
+    struct RawFields
+    {
+        bytesConstRef hashFieldsData;
+        bytesConstRef hashFieldsHash;
+        bytesConstRef signatureData;
+        int64_t importTime = 0;
+        uint32_t attribute = 0;
+        std::string_view source;
+
+        int32_t version = 0;
+        std::string_view chainId;
+        std::string_view groupId;
+        int64_t blockLimit = 0;
+        bytesConstRef nonce;
+        std::string_view to;
+        bytesConstRef input;
+    };
+    // keeps m_rawData valid, nullptr if the fields are held by the protobuf objects
+    std::shared_ptr<const void> m_rawDataOwner;
+    bytesConstRef m_rawData;
+    RawFields m_rawFields;
+
     u256 m_nonce;
 };
 }  // namespace protocol
@@ -44,6 +44,13 @@ public:
         return std::make_shared<PBTransaction>(m_cryptoSuite, _txData, _checkSig);
     }
 
+    // decode the transaction without copy, _txData must be kept valid by _txDataOwner
+    Transaction::Ptr createTransaction(
+        bytesConstRef _txData, std::shared_ptr<const void> _txDataOwner, bool _checkSig = true)
+    {
+        return std::make_shared<PBTransaction>(m_cryptoSuite, _txData, _txDataOwner, _checkSig);
+    }
+
     Transaction::Ptr createTransaction(bytes const& _txData, bool _checkSig = true) override
     {
         return std::make_shared<PBTransaction>(m_cryptoSuite, _txData, _checkSig);
@@ -36,6 +36,15 @@ PBTransactionReceipt::PBTransactionReceipt(
     decode(_receiptData);
 }
 
+PBTransactionReceipt::PBTransactionReceipt(CryptoSuite::Ptr _cryptoSuite,
+    bytesConstRef _receiptData, std::shared_ptr<google::protobuf::Arena> _arena)
+  : TransactionReceipt(_cryptoSuite),
+    m_receipt(createPBObjectOnArena<PBRawTransactionReceipt>(_arena))
+{
+    m_dataCache = std::make_shared<bytes>();
+    decode(_receiptData);
+}
+
 PBTransactionReceipt::PBTransactionReceipt(CryptoSuite::Ptr _cryptoSuite, int32_t _version,
     u256 const& _gasUsed, const std::string_view& _contractAddress, LogEntriesPtr _logEntries,
     int32_t _status, BlockNumber _blockNumber)
@@ -113,10 +122,11 @@ void PBTransactionReceipt::encodeHashFields() const
         return;
     }
     // encode the hashFieldsData
-    ScaleEncoderStream stream;
+    auto hashFieldsData = m_receipt->mutable_hashfieldsdata();
+    hashFieldsData->resize(scaleEncodedSize(
+        m_status, m_output, m_contractAddress, m_gasUsed, m_logEntries, m_blockNumber));
+    ScaleEncoderStream stream((byte*)hashFieldsData->data(), hashFieldsData->size());
     stream << m_status << m_output << m_contractAddress << m_gasUsed << m_logEntries
            << m_blockNumber;
-    auto hashFieldsData = stream.data();
     m_receipt->set_version(m_version);
-    m_receipt->set_hashfieldsdata(hashFieldsData.data(), hashFieldsData.size());
 }
\ No newline at end of file
@@ -35,6 +35,9 @@ public:
     PBTransactionReceipt(bcos::crypto::CryptoSuite::Ptr _cryptoSuite, bytes const& _receiptData)
       : PBTransactionReceipt(_cryptoSuite, ref(_receiptData))
     {}
+    // decode the receipt into the message allocated on the given arena
+    PBTransactionReceipt(bcos::crypto::CryptoSuite::Ptr _cryptoSuite, bytesConstRef _receiptData,
+        std::shared_ptr<google::protobuf::Arena> _arena);
 
     PBTransactionReceipt(bcos::crypto::CryptoSuite::Ptr _cryptoSuite, int32_t _version,
         u256 const& _gasUsed, const std::string_view& _contractAddress, LogEntriesPtr _logEntries,
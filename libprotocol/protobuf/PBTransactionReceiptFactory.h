@@ -46,6 +46,13 @@ public:
         return std::make_shared<PBTransactionReceipt>(m_cryptoSuite, _receiptData);
     }
 
+    // decode the receipt into the given arena, used to decode the receipts of a block
+    TransactionReceipt::Ptr createReceipt(
+        bytesConstRef _receiptData, std::shared_ptr<google::protobuf::Arena> _arena)
+    {
+        return std::make_shared<PBTransactionReceipt>(m_cryptoSuite, _receiptData, _arena);
+    }
+
     TransactionReceipt::Ptr createReceipt(u256 const& _gasUsed,
         const std::string_view& _contractAddress, LogEntriesPtr _logEntries, int32_t _status,
         bytes const& _output, BlockNumber _blockNumber) override
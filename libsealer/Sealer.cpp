@@ -31,8 +31,21 @@ void Sealer::start()
         return;
     }
     SEAL_LOG(INFO) << LOG_DESC("start the sealer");
-    startWorking();
     m_running = true;
+    if (m_executor)
+    {
+        auto self = std::weak_ptr<Sealer>(shared_from_this());
+        m_taskId = m_executor->registerTask([self]() {
+            auto sealer = self.lock();
+            if (!sealer)
+            {
+                return false;
+            }
+            return sealer->executeSealing();
+        });
+        return;
+    }
+    startWorking();
 }
 
 void Sealer::stop()
@@ -44,6 +57,12 @@ void Sealer::stop()
     }
     SEAL_LOG(INFO) << LOG_DESC("stop the sealer");
     m_running = false;
+    if (m_executor)
+    {
+        m_executor->unregisterTask(m_taskId);
+        m_sealingManager->stop();
+        return;
+    }
     m_sealingManager->stop();
     finishWorker();
     if (isWorking())
@@ -97,24 +116,38 @@ void Sealer::executeWorker()
         boost::unique_lock<boost::mutex> l(x_signalled);
         m_signalled.wait_for(l, boost::chrono::milliseconds(1));
     }
+    executeSealing();
+}
+
+bool Sealer::executeSealing()
+{
+    bool executed = false;
     // try to generateProposal
     if (m_sealingManager->shouldGenerateProposal())
     {
         auto ret = m_sealingManager->generateProposal();
         auto proposal = ret.second;
-        submitProposal(ret.first, proposal);
+        if (proposal)
+        {
+            submitProposal(ret.first, proposal);
+            executed = true;
+        }
     }
     // try to fetch transactions
     if (m_sealingManager->shouldFetchTransaction())
     {
         m_sealingManager->fetchTransactions();
+        executed = true;
     }
+    return executed;
 }
 
 void Sealer::submitProposal(bool _containSysTxs, bcos::protocol::Block::Ptr _block)
 {
+    auto metrics = m_sealingManager->metrics();
     if (_block->blockHeader()->number() <= m_sealingManager->currentNumber())
     {
+        metrics->incDroppedProposals();
         m_sealingManager->notifyResetProposal(_block);
         return;
     }
@@ -130,17 +163,21 @@ void Sealer::submitProposal(bool _containSysTxs, bcos::protocol::Block::Ptr _blo
     _block->blockHeader()->setSealerList(std::move(sealerList));
     _block->blockHeader()->setConsensusWeights(std::move(weightList));
     _block->blockHeader()->setSealer(m_sealerConfig->consensus()->nodeIndex());
-    auto encodedData = std::make_shared<bytes>();
+    // encode into the pooled buffer and hand it off to the consensus without copy
+    auto encodedData = m_proposalBufferPool->allocate();
+    auto startT = utcSteadyTimeUs();
     _block->encode(*encodedData);
+    metrics->encodeLatency().record(utcSteadyTimeUs() - startT);
     SEAL_LOG(INFO) << LOG_DESC("++++++++++++++++ Generate proposal")
                    << LOG_KV("index", _block->blockHeader()->number())
                    << LOG_KV("curNum", m_sealingManager->currentNumber())
                    << LOG_KV("hash", _block->blockHeader()->hash().abridged())
                    << LOG_KV("sysTxs", _containSysTxs)
                    << LOG_KV("txsSize", _block->transactionsHashSize());
-    m_sealerConfig->consensus()->asyncSubmitProposal(_containSysTxs, ref(*encodedData),
+    m_sealerConfig->consensus()->asyncSubmitEncodedProposal(_containSysTxs, encodedData,
         _block->blockHeader()->number(), _block->blockHeader()->hash(),
-        [_block](Error::Ptr _error) {
+        [_block, metrics, submitT = utcSteadyTimeUs()](Error::Ptr _error) {
+            metrics->submitLatency().record(utcSteadyTimeUs() - submitT);
             if (_error == nullptr)
             {
                 return;
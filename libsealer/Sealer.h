@@ -19,8 +19,10 @@
  */
 #pragma once
 #include "../interfaces/sealer/SealerInterface.h"
+#include "../libutilities/BytesPool.h"
 #include "../libutilities/Worker.h"
 #include "SealerConfig.h"
+#include "SealingExecutor.h"
 #include "SealingManager.h"
 
 namespace bcos
@@ -32,11 +34,25 @@ class Sealer : public Worker, public SealerInterface, public std::enable_shared_
 public:
     using Ptr = std::shared_ptr<Sealer>;
     explicit Sealer(SealerConfig::Ptr _sealerConfig)
-      : Worker("Sealer", 0), m_sealerConfig(_sealerConfig)
+      : Worker("Sealer", 0),
+        m_sealerConfig(_sealerConfig),
+        m_proposalBufferPool(std::make_shared<BytesPool>())
     {
         m_sealingManager = std::make_shared<SealingManager>(_sealerConfig);
         m_sealingManager->onReady([=]() { this->noteGenerateProposal(); });
     }
+
+    // the sealer is driven by the executor shared with other groups instead of its own thread
+    Sealer(SealerConfig::Ptr _sealerConfig, SealingExecutor::Ptr _executor)
+      : Worker("Sealer", 0),
+        m_sealerConfig(_sealerConfig),
+        m_proposalBufferPool(std::make_shared<BytesPool>()),
+        m_executor(_executor)
+    {
+        m_sealingManager =
+            std::make_shared<SealingManager>(_sealerConfig, _executor->asyncWorker());
+        m_sealingManager->onReady([=]() { this->noteGenerateProposal(); });
+    }
     virtual ~Sealer() {}
 
     void start() override;
@@ -53,15 +69,33 @@ public:
 
     virtual void init(bcos::consensus::ConsensusInterface::Ptr _consensus);
 
+    // query the latency histograms, queue gauges and counters of the sealer
+    SealerMetrics::Ptr metrics() const { return m_sealingManager->metrics(); }
+
 protected:
     void executeWorker() override;
-    virtual void noteGenerateProposal() { m_signalled.notify_all(); }
+    // generate proposal and fetch transactions if needed, returns false if nothing has been done
+    virtual bool executeSealing();
+    virtual void noteGenerateProposal()
+    {
+        if (m_executor)
+        {
+            m_executor->notify(m_taskId);
+            return;
+        }
+        m_signalled.notify_all();
+    }
 
     virtual void submitProposal(bool _containSysTxs, bcos::protocol::Block::Ptr _proposal);
 
 protected:
     SealerConfig::Ptr m_sealerConfig;
     SealingManager::Ptr m_sealingManager;
+    // the reusable buffers to encode the proposals into
+    BytesPool::Ptr m_proposalBufferPool;
+    SealingExecutor::Ptr m_executor;
+    // the id of the sealing task registered to m_executor
+    std::atomic<uint64_t> m_taskId = {0};
     std::atomic_bool m_running = {false};
 
     boost::condition_variable m_signalled;
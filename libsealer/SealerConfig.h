@@ -44,6 +44,13 @@ public:
     virtual unsigned minSealTime() const { return m_minSealTime; }
     virtual void setMinSealTime(unsigned _minSealTime) { m_minSealTime = _minSealTime; }
 
+    // the max number of the in-flight asyncSealTxs requests
+    virtual size_t maxInflightFetchRequests() const { return m_maxInflightFetchRequests; }
+    virtual void setMaxInflightFetchRequests(size_t _maxInflightFetchRequests)
+    {
+        m_maxInflightFetchRequests = std::max(_maxInflightFetchRequests, (size_t)1);
+    }
+
     bcos::protocol::BlockFactory::Ptr blockFactory() { return m_blockFactory; }
     bcos::consensus::ConsensusInterface::Ptr consensus() { return m_consensus; }
 
@@ -52,6 +59,7 @@ protected:
     bcos::protocol::BlockFactory::Ptr m_blockFactory;
     bcos::consensus::ConsensusInterface::Ptr m_consensus;
     unsigned m_minSealTime = 500;
+    size_t m_maxInflightFetchRequests = 2;
 };
 }  // namespace sealer
 }  // namespace bcos
\ No newline at end of file
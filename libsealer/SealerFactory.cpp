@@ -23,13 +23,21 @@ using namespace bcos;
 using namespace bcos::sealer;
 
 SealerFactory::SealerFactory(bcos::protocol::BlockFactory::Ptr _blockFactory,
-    bcos::txpool::TxPoolInterface::Ptr _txpool, unsigned _minSealTime)
-  : m_blockFactory(_blockFactory), m_txpool(_txpool), m_minSealTime(_minSealTime)
+    bcos::txpool::TxPoolInterface::Ptr _txpool, unsigned _minSealTime,
+    SealingExecutor::Ptr _executor)
+  : m_blockFactory(_blockFactory),
+    m_txpool(_txpool),
+    m_minSealTime(_minSealTime),
+    m_executor(_executor)
 {}
 
 Sealer::Ptr SealerFactory::createSealer()
 {
     auto sealerConfig = std::make_shared<SealerConfig>(m_blockFactory, m_txpool);
     sealerConfig->setMinSealTime(m_minSealTime);
+    if (m_executor)
+    {
+        return std::make_shared<Sealer>(sealerConfig, m_executor);
+    }
     return std::make_shared<Sealer>(sealerConfig);
 }
\ No newline at end of file
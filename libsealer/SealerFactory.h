@@ -29,7 +29,8 @@ class SealerFactory
 public:
     using Ptr = std::shared_ptr<SealerFactory>;
     SealerFactory(bcos::protocol::BlockFactory::Ptr _blockFactory,
-        bcos::txpool::TxPoolInterface::Ptr _txpool, unsigned _minSealTime);
+        bcos::txpool::TxPoolInterface::Ptr _txpool, unsigned _minSealTime,
+        SealingExecutor::Ptr _executor = nullptr);
 
     virtual ~SealerFactory() {}
     Sealer::Ptr createSealer();
@@ -38,6 +39,9 @@ protected:
     bcos::protocol::BlockFactory::Ptr m_blockFactory;
     bcos::txpool::TxPoolInterface::Ptr m_txpool;
     unsigned m_minSealTime;
+    // the sealing executor shared by multiple groups
+    // nullptr means that each sealer runs on its own thread
+    SealingExecutor::Ptr m_executor;
 };
 }  // namespace sealer
 }  // namespace bcos
\ No newline at end of file
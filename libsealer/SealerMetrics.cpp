@@ -0,0 +1,106 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief metrics of the sealer
+ * @file SealerMetrics.cpp
+ * @author: yujiechen
+ * @date: 2021-10-18
+ */
+#include "SealerMetrics.h"
+#include <limits>
+using namespace bcos;
+using namespace bcos::sealer;
+
+uint64_t LatencyHistogram::bucketBound(size_t _bucketIndex)
+{
+    if (_bucketIndex + 1 >= c_bucketsNum)
+    {
+        return std::numeric_limits<uint64_t>::max();
+    }
+    return (c_firstBucketBound << _bucketIndex);
+}
+
+void LatencyHistogram::record(uint64_t _latencyUs)
+{
+    size_t bucketIndex = 0;
+    while (bucketIndex + 1 < c_bucketsNum && _latencyUs >= bucketBound(bucketIndex))
+    {
+        bucketIndex++;
+    }
+    m_buckets[bucketIndex]++;
+    m_count++;
+    m_sum += _latencyUs;
+    auto currentMax = m_max.load();
+    while (_latencyUs > currentMax && !m_max.compare_exchange_weak(currentMax, _latencyUs))
+    {
+    }
+}
+
+void LatencyHistogram::reset()
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket = 0;
+    }
+    m_count = 0;
+    m_sum = 0;
+    m_max = 0;
+}
+
+std::vector<uint64_t> LatencyHistogram::buckets() const
+{
+    std::vector<uint64_t> result;
+    result.reserve(c_bucketsNum);
+    for (auto const& bucket : m_buckets)
+    {
+        result.push_back(bucket.load());
+    }
+    return result;
+}
+
+uint64_t LatencyHistogram::percentile(double _percentile) const
+{
+    auto bucketsData = buckets();
+    uint64_t totalCount = 0;
+    for (auto const& bucketCount : bucketsData)
+    {
+        totalCount += bucketCount;
+    }
+    if (totalCount == 0)
+    {
+        return 0;
+    }
+    auto expectedCount = (uint64_t)(_percentile * totalCount);
+    uint64_t accumulatedCount = 0;
+    for (size_t i = 0; i < bucketsData.size(); i++)
+    {
+        accumulatedCount += bucketsData[i];
+        if (accumulatedCount >= expectedCount && accumulatedCount > 0)
+        {
+            // the max latency is more precise than the unbounded bucket
+            return std::min(bucketBound(i), max());
+        }
+    }
+    return max();
+}
+
+void SealerMetrics::reset()
+{
+    m_fetchLatency.reset();
+    m_assembleLatency.reset();
+    m_encodeLatency.reset();
+    m_submitLatency.reset();
+    m_droppedProposals = 0;
+}
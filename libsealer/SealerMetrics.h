@@ -0,0 +1,116 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief metrics of the sealer
+ * @file SealerMetrics.h
+ * @author: yujiechen
+ * @date: 2021-10-18
+ */
+#pragma once
+#include "../libutilities/Common.h"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+namespace bcos
+{
+namespace sealer
+{
+// lock-free latency histogram with exponential buckets, the upper bound of bucket i is
+// (c_firstBucketBound << i) microseconds, the last bucket collects all the larger latencies
+class LatencyHistogram
+{
+public:
+    static constexpr size_t c_bucketsNum = 16;
+    static constexpr uint64_t c_firstBucketBound = 100;
+
+    LatencyHistogram() { reset(); }
+
+    void record(uint64_t _latencyUs);
+    void reset();
+
+    uint64_t count() const { return m_count.load(); }
+    // total latency in microseconds
+    uint64_t sum() const { return m_sum.load(); }
+    uint64_t max() const { return m_max.load(); }
+    uint64_t avg() const
+    {
+        auto recordCount = count();
+        return recordCount == 0 ? 0 : (sum() / recordCount);
+    }
+    std::vector<uint64_t> buckets() const;
+    // the upper bound(us) of the given bucket, the last bucket is unbounded
+    static uint64_t bucketBound(size_t _bucketIndex);
+    // estimate the given percentile(0~1) with the upper bound of the bucket it falls in
+    uint64_t percentile(double _percentile) const;
+
+private:
+    std::array<std::atomic<uint64_t>, c_bucketsNum> m_buckets;
+    std::atomic<uint64_t> m_count = {0};
+    std::atomic<uint64_t> m_sum = {0};
+    std::atomic<uint64_t> m_max = {0};
+};
+
+// the instrumentation of the sealer, can be queried in-process to tune the seal parameters
+class SealerMetrics
+{
+public:
+    using Ptr = std::shared_ptr<SealerMetrics>;
+    SealerMetrics() = default;
+    virtual ~SealerMetrics() {}
+
+    // latency from the asyncSealTxs call to its callback
+    LatencyHistogram& fetchLatency() { return m_fetchLatency; }
+    LatencyHistogram const& fetchLatency() const { return m_fetchLatency; }
+    // latency to assemble the proposal from the pending txs
+    LatencyHistogram& assembleLatency() { return m_assembleLatency; }
+    LatencyHistogram const& assembleLatency() const { return m_assembleLatency; }
+    // latency to encode the proposal
+    LatencyHistogram& encodeLatency() { return m_encodeLatency; }
+    LatencyHistogram const& encodeLatency() const { return m_encodeLatency; }
+    // latency from the asyncSubmitProposal call to its callback
+    LatencyHistogram& submitLatency() { return m_submitLatency; }
+    LatencyHistogram const& submitLatency() const { return m_submitLatency; }
+
+    void setPendingTxsSize(size_t _pendingTxsSize) { m_pendingTxsSize = _pendingTxsSize; }
+    size_t pendingTxsSize() const { return m_pendingTxsSize; }
+    void setPendingSysTxsSize(size_t _pendingSysTxsSize)
+    {
+        m_pendingSysTxsSize = _pendingSysTxsSize;
+    }
+    size_t pendingSysTxsSize() const { return m_pendingSysTxsSize; }
+    void setUnsealedTxsSize(size_t _unsealedTxsSize) { m_unsealedTxsSize = _unsealedTxsSize; }
+    size_t unsealedTxsSize() const { return m_unsealedTxsSize; }
+
+    // proposals dropped because the number is not larger than the current block number
+    void incDroppedProposals() { m_droppedProposals++; }
+    uint64_t droppedProposals() const { return m_droppedProposals; }
+
+    void reset();
+
+private:
+    LatencyHistogram m_fetchLatency;
+    LatencyHistogram m_assembleLatency;
+    LatencyHistogram m_encodeLatency;
+    LatencyHistogram m_submitLatency;
+
+    std::atomic<size_t> m_pendingTxsSize = {0};
+    std::atomic<size_t> m_pendingSysTxsSize = {0};
+    std::atomic<size_t> m_unsealedTxsSize = {0};
+
+    std::atomic<uint64_t> m_droppedProposals = {0};
+};
+}  // namespace sealer
+}  // namespace bcos
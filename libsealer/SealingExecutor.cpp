@@ -0,0 +1,198 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the sealing executor shared by the sealers of multiple groups
+ * @file SealingExecutor.cpp
+ * @author: yujiechen
+ * @date: 2021-10-18
+ */
+#include "SealingExecutor.h"
+#include <limits>
+#include <thread>
+using namespace bcos;
+using namespace bcos::sealer;
+
+namespace
+{
+// the id of the task executing in the current thread
+thread_local uint64_t t_executingTaskId = 0;
+}  // namespace
+
+SealingExecutor::SealingExecutor(size_t _threadNum, size_t _asyncWorkerNum, uint64_t _idleWaitMs)
+  : m_threadNum(std::max(_threadNum, (size_t)1)),
+    m_idleWaitMs(_idleWaitMs),
+    m_asyncWorker(
+        std::make_shared<ThreadPool>("sealerWorker", std::max(_asyncWorkerNum, (size_t)1)))
+{}
+
+void SealingExecutor::start()
+{
+    if (m_running)
+    {
+        SEAL_LOG(INFO) << LOG_DESC("the sealing executor has already been started");
+        return;
+    }
+    m_running = true;
+    for (size_t i = 0; i < m_threadNum; i++)
+    {
+        m_threads.emplace_back([this, i]() {
+            bcos::pthread_setThreadName("sealer-" + std::to_string(i));
+            executeLoop();
+        });
+    }
+    SEAL_LOG(INFO) << LOG_DESC("start the sealing executor") << LOG_KV("threads", m_threadNum);
+}
+
+void SealingExecutor::stop()
+{
+    if (!m_running)
+    {
+        return;
+    }
+    m_running = false;
+    m_signalled.notify_all();
+    for (auto& thread : m_threads)
+    {
+        if (thread.get_id() == std::this_thread::get_id())
+        {
+            thread.detach();
+            continue;
+        }
+        thread.join();
+    }
+    m_threads.clear();
+    m_asyncWorker->stop();
+    SEAL_LOG(INFO) << LOG_DESC("stop the sealing executor");
+}
+
+uint64_t SealingExecutor::registerTask(Task _task)
+{
+    auto entry = std::make_shared<TaskEntry>();
+    entry->task = std::move(_task);
+    {
+        std::lock_guard<std::mutex> l(x_tasks);
+        entry->id = ++m_taskIdCounter;
+        m_tasks.emplace_back(entry);
+    }
+    m_signalled.notify_one();
+    SEAL_LOG(INFO) << LOG_DESC("registerTask") << LOG_KV("id", entry->id);
+    return entry->id;
+}
+
+void SealingExecutor::unregisterTask(uint64_t _taskId)
+{
+    std::unique_lock<std::mutex> l(x_tasks);
+    auto it = std::find_if(m_tasks.begin(), m_tasks.end(),
+        [_taskId](std::shared_ptr<TaskEntry> const& _entry) { return _entry->id == _taskId; });
+    if (it == m_tasks.end())
+    {
+        return;
+    }
+    auto entry = *it;
+    entry->removed = true;
+    // wait for the running task to finish, unless unregistered by the task itself
+    if (t_executingTaskId != _taskId)
+    {
+        m_signalled.wait(l, [entry]() { return !entry->running; });
+    }
+    m_tasks.remove(entry);
+    SEAL_LOG(INFO) << LOG_DESC("unregisterTask") << LOG_KV("id", _taskId);
+}
+
+void SealingExecutor::notify(uint64_t _taskId)
+{
+    {
+        std::lock_guard<std::mutex> l(x_tasks);
+        for (auto const& entry : m_tasks)
+        {
+            if (entry->id != _taskId)
+            {
+                continue;
+            }
+            entry->nextRunTime = 0;
+            entry->notified = true;
+            break;
+        }
+    }
+    m_signalled.notify_one();
+}
+
+SealingExecutor::TaskList::iterator SealingExecutor::nextReadyTask(
+    uint64_t _now, uint64_t& _earliestRunTime)
+{
+    _earliestRunTime = std::numeric_limits<uint64_t>::max();
+    for (auto it = m_tasks.begin(); it != m_tasks.end(); it++)
+    {
+        auto const& entry = *it;
+        if (entry->running || entry->removed)
+        {
+            continue;
+        }
+        if (entry->nextRunTime <= _now)
+        {
+            return it;
+        }
+        _earliestRunTime = std::min(_earliestRunTime, entry->nextRunTime);
+    }
+    return m_tasks.end();
+}
+
+void SealingExecutor::executeLoop()
+{
+    while (m_running)
+    {
+        std::shared_ptr<TaskEntry> entry;
+        {
+            std::unique_lock<std::mutex> l(x_tasks);
+            auto now = utcSteadyTime();
+            uint64_t earliestRunTime = 0;
+            auto it = nextReadyTask(now, earliestRunTime);
+            if (it == m_tasks.end())
+            {
+                // wait until the earliest task is ready or some task is notified
+                auto waitTime = (earliestRunTime == std::numeric_limits<uint64_t>::max()) ?
+                                    m_idleWaitMs :
+                                    (earliestRunTime - now);
+                m_signalled.wait_for(l, std::chrono::milliseconds(waitTime));
+                continue;
+            }
+            entry = *it;
+            entry->running = true;
+            entry->notified = false;
+            // move the task to the tail to schedule the tasks round-robin
+            m_tasks.splice(m_tasks.end(), m_tasks, it);
+        }
+        bool busy = false;
+        t_executingTaskId = entry->id;
+        try
+        {
+            busy = entry->task();
+        }
+        catch (std::exception const& e)
+        {
+            SEAL_LOG(WARNING) << LOG_DESC("SealingExecutor: execute task exception")
+                              << LOG_KV("id", entry->id)
+                              << LOG_KV("error", boost::diagnostic_information(e));
+        }
+        t_executingTaskId = 0;
+        {
+            std::lock_guard<std::mutex> l(x_tasks);
+            entry->running = false;
+            // the idle task is re-scheduled after m_idleWaitMs unless notified
+            entry->nextRunTime = (busy || entry->notified) ? 0 : (utcSteadyTime() + m_idleWaitMs);
+        }
+        m_signalled.notify_all();
+    }
+}
@@ -0,0 +1,96 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the sealing executor shared by the sealers of multiple groups
+ * @file SealingExecutor.h
+ * @author: yujiechen
+ * @date: 2021-10-18
+ */
+#pragma once
+#include "../libutilities/ThreadPool.h"
+#include "Common.h"
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <thread>
+namespace bcos
+{
+namespace sealer
+{
+// SealingExecutor multiplexes the sealing loops of many groups over a small worker pool:
+// the registered tasks are scheduled round-robin, a task is never executed concurrently with
+// itself, and the idle tasks are re-scheduled after idleWaitMs unless notified earlier
+class SealingExecutor : public std::enable_shared_from_this<SealingExecutor>
+{
+public:
+    using Ptr = std::shared_ptr<SealingExecutor>;
+    // the task returns true if it has done some work, and false if it's idle
+    using Task = std::function<bool()>;
+
+    SealingExecutor(size_t _threadNum, size_t _asyncWorkerNum = 1, uint64_t _idleWaitMs = 1);
+    virtual ~SealingExecutor() { stop(); }
+
+    virtual void start();
+    virtual void stop();
+
+    // register the sealing task of a group, returns the task id
+    virtual uint64_t registerTask(Task _task);
+    // Note: the task will not be executed once this returns
+    virtual void unregisterTask(uint64_t _taskId);
+    // schedule the given task as soon as possible
+    virtual void notify(uint64_t _taskId);
+
+    // the thread pool shared by the sealing managers of all the groups
+    ThreadPool::Ptr asyncWorker() { return m_asyncWorker; }
+    size_t tasksSize() const
+    {
+        std::lock_guard<std::mutex> l(x_tasks);
+        return m_tasks.size();
+    }
+
+protected:
+    virtual void executeLoop();
+
+private:
+    struct TaskEntry
+    {
+        uint64_t id;
+        Task task;
+        // the steady time(ms) the task can be executed
+        uint64_t nextRunTime = 0;
+        bool running = false;
+        bool notified = false;
+        bool removed = false;
+    };
+    using TaskList = std::list<std::shared_ptr<TaskEntry>>;
+    // Note: must be called with x_tasks held
+    TaskList::iterator nextReadyTask(uint64_t _now, uint64_t& _earliestRunTime);
+
+private:
+    size_t m_threadNum;
+    uint64_t m_idleWaitMs;
+    ThreadPool::Ptr m_asyncWorker;
+
+    // the tasks are scheduled in FIFO order, the executed task is moved to the tail
+    TaskList m_tasks;
+    mutable std::mutex x_tasks;
+    std::condition_variable m_signalled;
+    uint64_t m_taskIdCounter = 0;
+
+    std::vector<std::thread> m_threads;
+    std::atomic_bool m_running = {false};
+};
+}  // namespace sealer
+}  // namespace bcos
@@ -22,6 +22,7 @@ using namespace bcos;
 using namespace bcos::sealer;
 using namespace bcos::crypto;
 using namespace bcos::protocol;
+using namespace bcos::txpool;
 
 void SealingManager::resetSealing()
 {
@@ -42,6 +43,7 @@ void SealingManager::appendTransactions(
         _txsQueue->emplace_back(
             std::const_pointer_cast<TransactionMetaData>(_fetchedTxs->transactionMetaData(i)));
     }
+    updatePendingTxsMetrics();
     m_onReady();
 }
 
@@ -86,44 +88,17 @@ void SealingManager::clearPendingTxs()
     {
         unHandledTxs->emplace_back(txMetaData->hash());
     }
-    auto self = std::weak_ptr<SealingManager>(shared_from_this());
-    m_worker->enqueue([self, unHandledTxs]() {
-        try
-        {
-            auto sealerMgr = self.lock();
-            if (!sealerMgr)
-            {
-                return;
-            }
-            sealerMgr->notifyResetTxsFlag(unHandledTxs, false);
-        }
-        catch (std::exception const& e)
-        {
-            SEAL_LOG(WARNING)
-                << LOG_DESC("shouldGenerateProposal: return back the unhandled txs exception")
-                << LOG_KV("error", boost::diagnostic_information(e));
-        }
-    });
+    notifyResetTxsFlag(unHandledTxs, false);
     UpgradeGuard ul(l);
     m_pendingTxs->clear();
     m_pendingSysTxs->clear();
+    updatePendingTxsMetrics();
 }
 
-void SealingManager::notifyResetTxsFlag(HashListPtr _txsHashList, bool _flag, size_t _retryTime)
+void SealingManager::notifyResetTxsFlag(HashListPtr _txsHashList, bool _flag)
 {
-    m_config->txpool()->asyncMarkTxs(_txsHashList, _flag, 0, HashType(),
-        [this, _txsHashList, _flag, _retryTime](Error::Ptr _error) {
-            if (_error == nullptr)
-            {
-                return;
-            }
-            SEAL_LOG(WARNING) << LOG_DESC("asyncMarkTxs failed, retry now");
-            if (_retryTime >= 3)
-            {
-                return;
-            }
-            this->notifyResetTxsFlag(_txsHashList, _flag, _retryTime + 1);
-        });
+    // the mark requests are coalesced and retried by the aggregator
+    m_txsMarkAggregator->asyncMarkTxs(_txsHashList, _flag);
 }
 
 void SealingManager::notifyResetProposal(bcos::protocol::Block::Ptr _block)
@@ -142,6 +117,7 @@ std::pair<bool, bcos::protocol::Block::Ptr> SealingManager::generateProposal()
     {
         return std::pair(false, nullptr);
     }
+    auto startT = utcSteadyTimeUs();
     WriteGuard l(x_pendingTxs);
     m_sealingNumber = std::max(m_sealingNumber.load(), m_currentNumber.load() + 1);
     auto block = m_config->blockFactory()->createBlock();
@@ -173,8 +149,10 @@ std::pair<bool, bcos::protocol::Block::Ptr> SealingManager::generateProposal()
         m_pendingTxs->pop_front();
     }
     m_sealingNumber++;
+    updatePendingTxsMetrics();
 
     m_lastSealTime = utcSteadyTime();
+    m_metrics->assembleLatency().record(utcSteadyTimeUs() - startT);
     // Note: When the last block(N) sealed by this node contains system transactions,
     //       if other nodes do not wait until block(N) is committed and directly seal block(N+1),
     //       will cause system exceptions.
@@ -202,8 +180,9 @@ bool SealingManager::reachMinSealTimeCondition()
 
 bool SealingManager::shouldFetchTransaction()
 {
-    // fetching transactions currently
-    if (m_fetchingTxs.load() || m_unsealedTxsSize == 0)
+    // the in-flight fetching requests reach the limit
+    if (m_inflightFetchRequests.load() >= m_config->maxInflightFetchRequests() ||
+        m_unsealedTxsSize == 0)
     {
         return false;
     }
@@ -218,7 +197,8 @@ bool SealingManager::shouldFetchTransaction()
 int64_t SealingManager::txsSizeExpectedToFetch()
 {
     auto txsSizeToFetch = (m_endSealingNumber - m_sealingNumber + 1) * m_maxTxsPerBlock;
-    auto txsSize = pendingTxsSize();
+    // the txs requested by the in-flight fetching requests
+    auto txsSize = pendingTxsSize() + m_inflightFetchTxsSize;
     if (txsSizeToFetch <= txsSize)
     {
         return 0;
@@ -226,51 +206,83 @@ int64_t SealingManager::txsSizeExpectedToFetch()
     return (txsSizeToFetch - txsSize);
 }
 
-void SealingManager::fetchTransactions()
+TxsHashSetPtr SealingManager::pendingTxsHashSet()
 {
-    if (!shouldFetchTransaction())
+    ReadGuard l(x_pendingTxs);
+    if (m_pendingTxs->empty() && m_pendingSysTxs->empty())
     {
-        return;
+        return nullptr;
     }
-    auto txsToFetch = txsSizeExpectedToFetch();
-    if (txsToFetch == 0)
+    auto txsHashSet = std::make_shared<TxsHashSet>();
+    for (auto const& txMetaData : *m_pendingTxs)
     {
-        return;
+        txsHashSet->insert(txMetaData->hash());
+    }
+    for (auto const& txMetaData : *m_pendingSysTxs)
+    {
+        txsHashSet->insert(txMetaData->hash());
     }
-    // try to fetch transactions
-    m_fetchingTxs = true;
+    return txsHashSet;
+}
+
+void SealingManager::fetchTransactions()
+{
+    // keep at most maxInflightFetchRequests requests in flight, each sized to about one block
+    while (shouldFetchTransaction())
+    {
+        auto txsToFetch = txsSizeExpectedToFetch();
+        if (txsToFetch <= 0)
+        {
+            return;
+        }
+        auto txsLimit = std::min((size_t)txsToFetch, std::max(m_maxTxsPerBlock.load(), (size_t)1));
+        asyncFetchTransactions(txsLimit);
+    }
+}
+
+void SealingManager::onFetchFinished(size_t _txsLimit)
+{
+    m_inflightFetchTxsSize -= _txsLimit;
+    m_inflightFetchRequests--;
+}
+
+void SealingManager::asyncFetchTransactions(size_t _txsLimit)
+{
+    m_inflightFetchRequests++;
+    m_inflightFetchTxsSize += _txsLimit;
+    // skip the transactions already pending
+    auto avoidTxs = pendingTxsHashSet();
     auto self = std::weak_ptr<SealingManager>(shared_from_this());
-    m_config->txpool()->asyncSealTxs(txsToFetch, nullptr,
-        [self](Error::Ptr _error, Block::Ptr _txsHashList, Block::Ptr _sysTxsList) {
+    auto startT = utcSteadyTimeUs();
+    m_config->txpool()->asyncSealTxs(_txsLimit, avoidTxs,
+        [self, startT, _txsLimit](
+            Error::Ptr _error, Block::Ptr _txsHashList, Block::Ptr _sysTxsList) {
+            auto sealingMgr = self.lock();
+            if (!sealingMgr)
+            {
+                return;
+            }
             try
             {
-                auto sealingMgr = self.lock();
-                if (!sealingMgr)
-                {
-                    return;
-                }
+                sealingMgr->m_metrics->fetchLatency().record(utcSteadyTimeUs() - startT);
                 if (_error != nullptr)
                 {
                     SEAL_LOG(WARNING) << LOG_DESC("fetchTransactions exception")
+                                      << LOG_KV("txsLimit", _txsLimit)
                                       << LOG_KV("returnCode", _error->errorCode())
                                       << LOG_KV("returnMsg", _error->errorMessage());
-                    sealingMgr->m_fetchingTxs = false;
+                    sealingMgr->onFetchFinished(_txsLimit);
                     return;
                 }
                 sealingMgr->appendTransactions(sealingMgr->m_pendingTxs, _txsHashList);
                 sealingMgr->appendTransactions(sealingMgr->m_pendingSysTxs, _sysTxsList);
-                sealingMgr->m_fetchingTxs = false;
             }
             catch (std::exception const& e)
             {
                 SEAL_LOG(WARNING) << LOG_DESC("fetchTransactions: onRecv sealed txs failed")
                                   << LOG_KV("error", boost::diagnostic_information(e))
-                                  << LOG_KV(
-                                         "fetchedTxsSize", _txsHashList->transactionsMetaDataSize())
-                                  << LOG_KV(
-                                         "fetchedSysTxs", _sysTxsList->transactionsMetaDataSize())
-                                  << LOG_KV("returnCode", _error->errorCode())
-                                  << LOG_KV("returnMsg", _error->errorMessage());
+                                  << LOG_KV("txsLimit", _txsLimit);
             }
+            sealingMgr->onFetchFinished(_txsLimit);
         });
-}
\ No newline at end of file
+}
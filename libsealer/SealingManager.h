@@ -24,6 +24,8 @@
 #include "../libutilities/ThreadPool.h"
 #include "Common.h"
 #include "SealerConfig.h"
+#include "SealerMetrics.h"
+#include "TxsMarkAggregator.h"
 namespace bcos
 {
 namespace sealer
@@ -35,17 +37,23 @@ public:
     using Ptr = std::shared_ptr<SealingManager>;
     using ConstPtr = std::shared_ptr<SealingManager const>;
     explicit SealingManager(SealerConfig::Ptr _config)
-      : m_config(_config),
-        m_pendingTxs(std::make_shared<TxsMetaDataQueue>()),
-        m_pendingSysTxs(std::make_shared<TxsMetaDataQueue>()),
-        m_worker(std::make_shared<ThreadPool>("sealerWorker", 1))
+      : SealingManager(_config, std::make_shared<ThreadPool>("sealerWorker", 1), true)
+    {}
+
+    // the worker is shared with the sealers of other groups and owned by the caller
+    SealingManager(SealerConfig::Ptr _config, ThreadPool::Ptr _worker)
+      : SealingManager(_config, _worker, false)
     {}
 
     virtual ~SealingManager() { stop(); }
 
     virtual void stop()
     {
-        if (m_worker)
+        if (m_txsMarkAggregator)
+        {
+            m_txsMarkAggregator->flush();
+        }
+        if (m_worker && m_ownWorker)
         {
             m_worker->stop();
         }
@@ -58,6 +66,7 @@ public:
     virtual void setUnsealedTxsSize(size_t _unsealedTxsSize)
     {
         m_unsealedTxsSize = _unsealedTxsSize;
+        m_metrics->setUnsealedTxsSize(_unsealedTxsSize);
         m_config->consensus()->asyncNoteUnSealedTxsSize(_unsealedTxsSize, [](Error::Ptr _error) {
             if (_error)
             {
@@ -104,17 +113,40 @@ public:
     }
     virtual void notifyResetProposal(bcos::protocol::Block::Ptr _block);
 
+    SealerMetrics::Ptr metrics() const { return m_metrics; }
+
 protected:
+    SealingManager(SealerConfig::Ptr _config, ThreadPool::Ptr _worker, bool _ownWorker)
+      : m_config(_config),
+        m_pendingTxs(std::make_shared<TxsMetaDataQueue>()),
+        m_pendingSysTxs(std::make_shared<TxsMetaDataQueue>()),
+        m_worker(_worker),
+        m_ownWorker(_ownWorker),
+        m_metrics(std::make_shared<SealerMetrics>())
+    {
+        m_txsMarkAggregator = std::make_shared<TxsMarkAggregator>(m_config->txpool(), m_worker);
+    }
+
     virtual void appendTransactions(
         std::shared_ptr<TxsMetaDataQueue> _txsQueue, bcos::protocol::Block::Ptr _fetchedTxs);
     virtual bool reachMinSealTimeCondition();
     virtual void clearPendingTxs();
-    virtual void notifyResetTxsFlag(
-        bcos::crypto::HashListPtr _txsHash, bool _flag, size_t _retryTime = 0);
+    virtual void notifyResetTxsFlag(bcos::crypto::HashListPtr _txsHash, bool _flag);
 
     virtual int64_t txsSizeExpectedToFetch();
+    // fetch at most _txsLimit transactions from the txpool asynchronously
+    virtual void asyncFetchTransactions(size_t _txsLimit);
+    virtual void onFetchFinished(size_t _txsLimit);
+    virtual bcos::txpool::TxsHashSetPtr pendingTxsHashSet();
     virtual size_t pendingTxsSize();
 
+    // Note: must be called with x_pendingTxs held
+    void updatePendingTxsMetrics()
+    {
+        m_metrics->setPendingTxsSize(m_pendingTxs->size());
+        m_metrics->setPendingSysTxsSize(m_pendingSysTxs->size());
+    }
+
 private:
     SealerConfig::Ptr m_config;
     std::shared_ptr<TxsMetaDataQueue> m_pendingTxs;
@@ -122,6 +154,10 @@ private:
     SharedMutex x_pendingTxs;
 
     ThreadPool::Ptr m_worker;
+    // whether m_worker is owned by this SealingManager
+    bool m_ownWorker;
+    TxsMarkAggregator::Ptr m_txsMarkAggregator;
+    SealerMetrics::Ptr m_metrics;
 
     std::atomic<uint64_t> m_lastSealTime = {0};
 
@@ -137,7 +173,10 @@ private:
 
     bcos::CallbackCollectionHandler<> m_onReady;
 
-    std::atomic_bool m_fetchingTxs = {false};
+    // the number of the in-flight fetching requests
+    std::atomic<size_t> m_inflightFetchRequests = {0};
+    // the txs size requested by the in-flight fetching requests
+    std::atomic<int64_t> m_inflightFetchTxsSize = {0};
 
     std::atomic<ssize_t> m_currentNumber = {0};
 };
@@ -0,0 +1,157 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief aggregate the asyncMarkTxs requests to the txpool
+ * @file TxsMarkAggregator.cpp
+ * @author: yujiechen
+ * @date: 2021-10-18
+ */
+#include "TxsMarkAggregator.h"
+using namespace bcos;
+using namespace bcos::sealer;
+using namespace bcos::crypto;
+
+void TxsMarkAggregator::asyncMarkTxs(HashListPtr _txsHashList, bool _flag)
+{
+    if (!_txsHashList || _txsHashList->empty())
+    {
+        return;
+    }
+    bool scheduleFlush = false;
+    bool flushNow = false;
+    {
+        std::lock_guard<std::mutex> l(x_pendingMarks);
+        for (auto const& txHash : *_txsHashList)
+        {
+            m_pendingMarks[txHash] = _flag;
+        }
+        if (m_pendingMarks.size() >= m_maxBatchSize)
+        {
+            flushNow = true;
+        }
+        else if (!m_flushScheduled)
+        {
+            m_flushScheduled = true;
+            scheduleFlush = true;
+        }
+    }
+    if (flushNow)
+    {
+        flush();
+        return;
+    }
+    if (!scheduleFlush)
+    {
+        return;
+    }
+    auto self = std::weak_ptr<TxsMarkAggregator>(shared_from_this());
+    m_worker->enqueueAfter(m_coalesceWindow, [self]() {
+        try
+        {
+            auto aggregator = self.lock();
+            if (!aggregator)
+            {
+                return;
+            }
+            aggregator->flush();
+        }
+        catch (std::exception const& e)
+        {
+            SEAL_LOG(WARNING) << LOG_DESC("TxsMarkAggregator: flush exception")
+                              << LOG_KV("error", boost::diagnostic_information(e));
+        }
+    });
+}
+
+void TxsMarkAggregator::flush()
+{
+    auto sealedTxs = std::make_shared<HashList>();
+    auto unsealedTxs = std::make_shared<HashList>();
+    {
+        std::lock_guard<std::mutex> l(x_pendingMarks);
+        m_flushScheduled = false;
+        if (m_pendingMarks.empty())
+        {
+            return;
+        }
+        for (auto const& it : m_pendingMarks)
+        {
+            if (it.second)
+            {
+                sealedTxs->emplace_back(it.first);
+                continue;
+            }
+            unsealedTxs->emplace_back(it.first);
+        }
+        m_pendingMarks.clear();
+    }
+    if (!sealedTxs->empty())
+    {
+        sendMarkRequest(sealedTxs, true, 0);
+    }
+    if (!unsealedTxs->empty())
+    {
+        sendMarkRequest(unsealedTxs, false, 0);
+    }
+}
+
+void TxsMarkAggregator::sendMarkRequest(HashListPtr _txsHashList, bool _flag, size_t _retryTime)
+{
+    auto self = std::weak_ptr<TxsMarkAggregator>(shared_from_this());
+    m_txpool->asyncMarkTxs(_txsHashList, _flag, 0, HashType(),
+        [self, _txsHashList, _flag, _retryTime](Error::Ptr _error) {
+            if (_error == nullptr)
+            {
+                return;
+            }
+            auto aggregator = self.lock();
+            if (!aggregator)
+            {
+                return;
+            }
+            if (_retryTime >= aggregator->m_maxRetryTime)
+            {
+                SEAL_LOG(WARNING) << LOG_DESC("asyncMarkTxs failed")
+                                  << LOG_KV("txsSize", _txsHashList->size())
+                                  << LOG_KV("flag", _flag) << LOG_KV("retryTime", _retryTime)
+                                  << LOG_KV("code", _error->errorCode())
+                                  << LOG_KV("msg", _error->errorMessage());
+                return;
+            }
+            // retry with exponential back-off on the worker instead of recursing in the callback
+            auto retryInterval = aggregator->m_retryInterval << _retryTime;
+            SEAL_LOG(WARNING) << LOG_DESC("asyncMarkTxs failed, retry later")
+                              << LOG_KV("txsSize", _txsHashList->size())
+                              << LOG_KV("retryTime", _retryTime)
+                              << LOG_KV("retryAfter", retryInterval);
+            aggregator->m_worker->enqueueAfter(
+                retryInterval, [self, _txsHashList, _flag, _retryTime]() {
+                    try
+                    {
+                        auto aggregator = self.lock();
+                        if (!aggregator)
+                        {
+                            return;
+                        }
+                        aggregator->sendMarkRequest(_txsHashList, _flag, _retryTime + 1);
+                    }
+                    catch (std::exception const& e)
+                    {
+                        SEAL_LOG(WARNING) << LOG_DESC("TxsMarkAggregator: retry exception")
+                                          << LOG_KV("error", boost::diagnostic_information(e));
+                    }
+                });
+        });
+}
@@ -0,0 +1,82 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief aggregate the asyncMarkTxs requests to the txpool
+ * @file TxsMarkAggregator.h
+ * @author: yujiechen
+ * @date: 2021-10-18
+ */
+#pragma once
+#include "../interfaces/txpool/TxPoolInterface.h"
+#include "../libutilities/ThreadPool.h"
+#include "Common.h"
+namespace bcos
+{
+namespace sealer
+{
+// coalesce the mark-txs requests within a short window, deduplicate the txs and send them to the
+// txpool with one asyncMarkTxs call per flag; the failed requests are retried with exponential
+// back-off
+class TxsMarkAggregator : public std::enable_shared_from_this<TxsMarkAggregator>
+{
+public:
+    using Ptr = std::shared_ptr<TxsMarkAggregator>;
+    TxsMarkAggregator(bcos::txpool::TxPoolInterface::Ptr _txpool, ThreadPool::Ptr _worker,
+        uint64_t _coalesceWindow = 10, size_t _maxBatchSize = 100000, size_t _maxRetryTime = 3,
+        uint64_t _retryInterval = 20)
+      : m_txpool(_txpool),
+        m_worker(_worker),
+        m_coalesceWindow(_coalesceWindow),
+        m_maxBatchSize(_maxBatchSize),
+        m_maxRetryTime(_maxRetryTime),
+        m_retryInterval(_retryInterval)
+    {}
+    virtual ~TxsMarkAggregator() {}
+
+    // append the txs to be marked, they are sent to the txpool when the coalesce window expires
+    virtual void asyncMarkTxs(bcos::crypto::HashListPtr _txsHashList, bool _flag);
+    // send all the pending mark requests to the txpool immediately
+    virtual void flush();
+
+    size_t pendingSize() const
+    {
+        std::lock_guard<std::mutex> l(x_pendingMarks);
+        return m_pendingMarks.size();
+    }
+
+protected:
+    virtual void sendMarkRequest(
+        bcos::crypto::HashListPtr _txsHashList, bool _flag, size_t _retryTime);
+
+private:
+    bcos::txpool::TxPoolInterface::Ptr m_txpool;
+    ThreadPool::Ptr m_worker;
+    // the window(ms) to coalesce the mark requests
+    uint64_t m_coalesceWindow;
+    // flush the pending requests immediately when the pending txs exceeds m_maxBatchSize
+    size_t m_maxBatchSize;
+    size_t m_maxRetryTime;
+    // the first retry interval(ms), doubled for each retry
+    uint64_t m_retryInterval;
+
+    // txHash => flag, the latest flag overwrites the previous one
+    std::unordered_map<bcos::crypto::HashType, bool, std::hash<bcos::crypto::HashType>>
+        m_pendingMarks;
+    mutable std::mutex x_pendingMarks;
+    // whether a flush has been scheduled for the current window
+    bool m_flushScheduled = false;
+};
+}  // namespace sealer
+}  // namespace bcos
@@ -404,6 +404,8 @@ crypto::HashType StateStorage::hash(const bcos::crypto::Hash::Ptr& hashImpl)
         tbb::spin_mutex hashMutex;
         tbb::parallel_for(m_data.range(),
             [&hashImpl, &hashMutex, &totalHash](decltype(m_data)::range_type& range) {
+                // accumulate the range locally and merge it into the total hash once
+                bcos::crypto::HashType rangeHash;
                 for (auto& it : range)
                 {
                     auto& entry = it.second;
@@ -413,17 +415,16 @@ crypto::HashType StateStorage::hash(const bcos::crypto::Hash::Ptr& hashImpl)
                         {
                             auto value = entry.getField(0);
                             bcos::bytesConstRef ref((const bcos::byte*)value.data(), value.size());
-                            auto hash = hashImpl->hash(ref);
-
-                            tbb::spin_mutex::scoped_lock lock(hashMutex);
-                            totalHash ^= hash;
+                            rangeHash ^= hashImpl->hash(ref);
                         }
                         else
                         {
-                            totalHash ^= bcos::crypto::HashType(0x1);
+                            rangeHash ^= bcos::crypto::HashType(0x1);
                         }
                     }
                 }
+                tbb::spin_mutex::scoped_lock lock(hashMutex);
+                totalHash ^= rangeHash;
             });
     }
 
@@ -18,19 +18,150 @@
  */
 
 #include "Base64.h"
-#include <boost/algorithm/string.hpp>
-#include <boost/archive/iterators/base64_from_binary.hpp>
-#include <boost/archive/iterators/binary_from_base64.hpp>
-#include <boost/archive/iterators/transform_width.hpp>
-#include <boost/iostreams/copy.hpp>
+#include "Exceptions.h"
+#include <array>
 
-using namespace boost::archive::iterators;
+using namespace bcos;
+
+namespace
+{
+constexpr char c_base64Chars[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// the invalid flag of the decoded value
+constexpr uint32_t c_invalidBase64 = 0x80000000;
+
+// the 6 bits of every char shifted to the position of the char in the 4-chars quantum, so a
+// quantum is decoded into 24 bits by the OR of four lookups, the invalid chars set the top bit
+constexpr std::array<std::array<uint32_t, 256>, 4> c_base64Values = []() {
+    std::array<std::array<uint32_t, 256>, 4> values{};
+    for (size_t position = 0; position < 4; position++)
+    {
+        for (size_t i = 0; i < 256; i++)
+        {
+            values[position][i] = c_invalidBase64;
+        }
+        for (uint32_t i = 0; i < 64; i++)
+        {
+            values[position][(uint8_t)c_base64Chars[i]] = i << (6 * (3 - position));
+        }
+    }
+    return values;
+}();
+
+inline uint32_t decodeQuantum(char const* _data)
+{
+    return c_base64Values[0][(uint8_t)_data[0]] | c_base64Values[1][(uint8_t)_data[1]] |
+           c_base64Values[2][(uint8_t)_data[2]] | c_base64Values[3][(uint8_t)_data[3]];
+}
+
+size_t paddingSize(std::string_view _data)
+{
+    if (_data.size() % 4 != 0)
+    {
+        BOOST_THROW_EXCEPTION(
+            BadBase64Data() << errinfo_comment(
+                "invalid base64 data size: " + std::to_string(_data.size())));
+    }
+    if (_data.empty() || _data.back() != '=')
+    {
+        return 0;
+    }
+    return _data[_data.size() - 2] == '=' ? 2 : 1;
+}
+}  // namespace
+
+size_t bcos::base64EncodeInto(bytesConstRef _data, char* _out)
+{
+    auto data = _data.data();
+    auto size = _data.size();
+    auto out = _out;
+    size_t i = 0;
+    for (; i + 3 <= size; i += 3)
+    {
+        uint32_t value = ((uint32_t)data[i] << 16) | ((uint32_t)data[i + 1] << 8) | data[i + 2];
+        out[0] = c_base64Chars[value >> 18];
+        out[1] = c_base64Chars[(value >> 12) & 0x3f];
+        out[2] = c_base64Chars[(value >> 6) & 0x3f];
+        out[3] = c_base64Chars[value & 0x3f];
+        out += 4;
+    }
+    // the last 1 or 2 bytes with the padding
+    if (i < size)
+    {
+        uint32_t value = (uint32_t)data[i] << 16;
+        if (i + 1 < size)
+        {
+            value |= (uint32_t)data[i + 1] << 8;
+        }
+        out[0] = c_base64Chars[value >> 18];
+        out[1] = c_base64Chars[(value >> 12) & 0x3f];
+        out[2] = (i + 1 < size) ? c_base64Chars[(value >> 6) & 0x3f] : '=';
+        out[3] = '=';
+        out += 4;
+    }
+    return out - _out;
+}
+
+size_t bcos::base64DecodedSize(std::string_view _data)
+{
+    return _data.size() / 4 * 3 - paddingSize(_data);
+}
+
+size_t bcos::base64DecodeInto(std::string_view _data, byte* _out)
+{
+    auto padding = paddingSize(_data);
+    if (_data.empty())
+    {
+        return 0;
+    }
+    auto data = _data.data();
+    // the last quantum is decoded separately for the padding
+    auto lastOffset = _data.size() - 4;
+    auto out = _out;
+    // accumulate the invalid flags to keep the loop branchless
+    uint32_t invalid = 0;
+    for (size_t i = 0; i < lastOffset; i += 4)
+    {
+        auto value = decodeQuantum(data + i);
+        invalid |= value;
+        out[0] = (byte)(value >> 16);
+        out[1] = (byte)(value >> 8);
+        out[2] = (byte)value;
+        out += 3;
+    }
+    // the padding chars of the last quantum are decoded as the zero bits
+    char last[4] = {
+        data[lastOffset], data[lastOffset + 1], data[lastOffset + 2], data[lastOffset + 3]};
+    for (size_t i = 4 - padding; i < 4; i++)
+    {
+        last[i] = 'A';
+    }
+    auto value = decodeQuantum(last);
+    invalid |= value;
+    // the bits of the padding must be zero
+    uint32_t paddingBits = (1u << (8 * padding)) - 1;
+    if ((invalid & c_invalidBase64) || (value & paddingBits))
+    {
+        BOOST_THROW_EXCEPTION(BadBase64Data() << errinfo_comment("invalid base64 data"));
+    }
+    out[0] = (byte)(value >> 16);
+    if (padding < 2)
+    {
+        out[1] = (byte)(value >> 8);
+    }
+    if (padding < 1)
+    {
+        out[2] = (byte)value;
+    }
+    return out + 3 - padding - _out;
+}
 
 std::string bcos::base64Encode(const byte* _begin, const size_t _dataSize)
 {
-    using It = base64_from_binary<transform_width<byte*, 6, 8>>;
-    auto tmp = std::string(It(_begin), It(_begin + _dataSize));
-    return tmp.append((3 - _dataSize % 3) % 3, '=');
+    std::string ret(base64EncodedSize(_dataSize), '\0');
+    base64EncodeInto(bytesConstRef(_begin, _dataSize), ret.data());
+    return ret;
 }
 
 std::string bcos::base64Encode(std::string const& _data)
@@ -43,28 +174,16 @@ std::string bcos::base64Encode(bytesConstRef _data)
     return base64Encode(_data.data(), _data.size());
 }
 
-std::string bcos::base64Decode(std::string const& _data)
+std::string bcos::base64Decode(std::string_view _data)
 {
-    size_t suffix = 0;
-    for (size_t i = _data.size() - 1; i >= _data.size() - 3; --i)
-    {
-        if (_data[i] == '=')
-        {
-            ++suffix;
-        }
-        else
-        {
-            break;
-        }
-    }
-    using It = transform_width<binary_from_base64<std::string::const_iterator>, 8, 6>;
-    auto ret = std::string(It(_data.begin()), It(std::end(_data)));
-    ret.resize(ret.size() - suffix);
+    std::string ret(base64DecodedSize(_data), '\0');
+    base64DecodeInto(_data, (byte*)ret.data());
     return ret;
 }
 
-std::shared_ptr<bcos::bytes> bcos::base64DecodeBytes(std::string const& _data)
+std::shared_ptr<bcos::bytes> bcos::base64DecodeBytes(std::string_view _data)
 {
-    auto s = base64Decode(_data);
-    return std::make_shared<bcos::bytes>(s.begin(), s.end());
+    auto ret = std::make_shared<bcos::bytes>(base64DecodedSize(_data));
+    base64DecodeInto(_data, ret->data());
+    return ret;
 }
@@ -18,6 +18,7 @@
  */
 #pragma once
 #include "Common.h"
+#include <string_view>
 
 namespace bcos
 {
@@ -26,6 +27,23 @@ std::string base64Encode(const byte* _begin, const size_t _dataSize);
 std::string base64Encode(std::string const& _data);
 std::string base64Encode(bytesConstRef _data);
 
-std::shared_ptr<bytes> base64DecodeBytes(std::string const& _data);
-std::string base64Decode(std::string const& _data);
+// the base64 decoders accept the padded standard alphabet only, and throw BadBase64Data for the
+// invalid size, the invalid chars, the misplaced padding and the non-zero padding bits
+std::shared_ptr<bytes> base64DecodeBytes(std::string_view _data);
+std::string base64Decode(std::string_view _data);
+
+// the size of the base64 text encoded from _dataSize bytes, padding included
+inline size_t base64EncodedSize(size_t _dataSize)
+{
+    return (_dataSize + 2) / 3 * 4;
+}
+// the size of the data decoded from the base64 text
+size_t base64DecodedSize(std::string_view _data);
+
+// encode the data into the preallocated _out of base64EncodedSize(_data.size()) chars, and
+// return the count of the written chars
+size_t base64EncodeInto(bytesConstRef _data, char* _out);
+// decode the base64 text into the preallocated _out of base64DecodedSize(_data) bytes, and
+// return the count of the written bytes
+size_t base64DecodeInto(std::string_view _data, byte* _out);
 }  // namespace bcos
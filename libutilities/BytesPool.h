@@ -0,0 +1,98 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief: pool of reusable bytes buffers
+ *
+ * @file BytesPool.h
+ * @author: yujiechen
+ * @date 2021-10-18
+ */
+#pragma once
+#include "Common.h"
+#include <memory>
+#include <mutex>
+
+namespace bcos
+{
+// BytesPool hands out refcounted bytes buffers, a buffer is cleared and returned to the pool
+// (with its capacity retained) once the last reference to it is released
+class BytesPool : public std::enable_shared_from_this<BytesPool>
+{
+public:
+    using Ptr = std::shared_ptr<BytesPool>;
+    explicit BytesPool(size_t _maxPooledBuffers = 8, size_t _maxBufferCapacity = 64 * 1024 * 1024)
+      : m_maxPooledBuffers(_maxPooledBuffers), m_maxBufferCapacity(_maxBufferCapacity)
+    {}
+    virtual ~BytesPool() {}
+
+    // Note: the pool must be held by a shared_ptr
+    bytesPointer allocate()
+    {
+        bytes* buffer = nullptr;
+        {
+            std::lock_guard<std::mutex> l(x_buffers);
+            if (!m_buffers.empty())
+            {
+                buffer = m_buffers.back().release();
+                m_buffers.pop_back();
+            }
+        }
+        if (!buffer)
+        {
+            buffer = new bytes();
+        }
+        auto pool = std::weak_ptr<BytesPool>(shared_from_this());
+        return bytesPointer(buffer, [pool](bytes* _buffer) {
+            auto bytesPool = pool.lock();
+            if (!bytesPool)
+            {
+                delete _buffer;
+                return;
+            }
+            bytesPool->recycle(_buffer);
+        });
+    }
+
+    size_t pooledBuffers() const
+    {
+        std::lock_guard<std::mutex> l(x_buffers);
+        return m_buffers.size();
+    }
+
+private:
+    void recycle(bytes* _buffer)
+    {
+        std::unique_ptr<bytes> buffer(_buffer);
+        // release the over-sized buffer to avoid holding too much memory
+        if (buffer->capacity() > m_maxBufferCapacity)
+        {
+            return;
+        }
+        buffer->clear();
+        std::lock_guard<std::mutex> l(x_buffers);
+        if (m_buffers.size() >= m_maxPooledBuffers)
+        {
+            return;
+        }
+        m_buffers.emplace_back(std::move(buffer));
+    }
+
+private:
+    size_t m_maxPooledBuffers;
+    size_t m_maxBufferCapacity;
+    std::vector<std::unique_ptr<bytes>> m_buffers;
+    mutable std::mutex x_buffers;
+};
+}  // namespace bcos
@@ -17,12 +17,236 @@
  */
 
 #include "DataConvertUtility.h"
+#include <array>
 #include <random>
 
 #include "Exceptions.h"
 
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define BCOS_HEX_SIMD 1
+#endif
+
 using namespace std;
 using namespace bcos;
+
+namespace
+{
+constexpr char c_hexChars[] = "0123456789abcdef";
+
+// the value of the hex char, -1 for the non-hex char, constant-initialized to be used by the
+// static hex data of other translation units
+constexpr std::array<int8_t, 256> c_hexValues = []() {
+    std::array<int8_t, 256> values{};
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = -1;
+    }
+    for (int i = 0; i < 10; i++)
+    {
+        values['0' + i] = (int8_t)i;
+    }
+    for (int i = 0; i < 6; i++)
+    {
+        values['a' + i] = (int8_t)(i + 10);
+        values['A' + i] = (int8_t)(i + 10);
+    }
+    return values;
+}();
+
+void hexEncodeScalar(bcos::byte const* _data, size_t _size, char* _out)
+{
+    for (size_t i = 0; i < _size; i++)
+    {
+        _out[2 * i] = c_hexChars[_data[i] >> 4];
+        _out[2 * i + 1] = c_hexChars[_data[i] & 0x0f];
+    }
+}
+
+bool hexDecodeScalar(char const* _hex, size_t _size, bcos::byte* _out)
+{
+    // accumulate the invalid flags to keep the loop branchless
+    int8_t invalid = 0;
+    for (size_t i = 0; i < _size / 2; i++)
+    {
+        auto high = c_hexValues[(uint8_t)_hex[2 * i]];
+        auto low = c_hexValues[(uint8_t)_hex[2 * i + 1]];
+        invalid |= (high | low);
+        _out[i] = (bcos::byte)((high << 4) | low);
+    }
+    return invalid >= 0;
+}
+
+#ifdef BCOS_HEX_SIMD
+// the nibbles to the hex chars: n + '0', plus 'a' - '0' - 10 for the nibbles above 9
+inline __m128i nibblesToChars(__m128i _nibbles)
+{
+    auto letters = _mm_and_si128(_mm_cmpgt_epi8(_nibbles, _mm_set1_epi8(9)), _mm_set1_epi8(39));
+    return _mm_add_epi8(_mm_add_epi8(_nibbles, _mm_set1_epi8('0')), letters);
+}
+
+// the hex chars to the nibbles, the mask of the valid chars is set into _valid
+inline __m128i charsToNibbles(__m128i _chars, __m128i& _valid)
+{
+    auto digits = _mm_sub_epi8(_chars, _mm_set1_epi8('0'));
+    auto isDigit = _mm_and_si128(_mm_cmpgt_epi8(digits, _mm_set1_epi8(-1)),
+        _mm_cmplt_epi8(digits, _mm_set1_epi8(10)));
+    // the lower case letters and the upper case letters
+    auto letters = _mm_sub_epi8(_mm_or_si128(_chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    auto isLetter = _mm_and_si128(_mm_cmpgt_epi8(letters, _mm_set1_epi8(-1)),
+        _mm_cmplt_epi8(letters, _mm_set1_epi8(6)));
+    _valid = _mm_and_si128(_valid, _mm_or_si128(isDigit, isLetter));
+    return _mm_or_si128(_mm_and_si128(isDigit, digits),
+        _mm_and_si128(isLetter, _mm_add_epi8(letters, _mm_set1_epi8(10))));
+}
+
+// the 16 bytes to the 32 hex chars
+size_t hexEncodeSSE2(bcos::byte const* _data, size_t _size, char* _out)
+{
+    size_t offset = 0;
+    auto mask = _mm_set1_epi8(0x0f);
+    for (; offset + 16 <= _size; offset += 16)
+    {
+        auto input = _mm_loadu_si128((__m128i const*)(_data + offset));
+        auto high = nibblesToChars(_mm_and_si128(_mm_srli_epi16(input, 4), mask));
+        auto low = nibblesToChars(_mm_and_si128(input, mask));
+        _mm_storeu_si128((__m128i*)(_out + 2 * offset), _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128((__m128i*)(_out + 2 * offset + 16), _mm_unpackhi_epi8(high, low));
+    }
+    return offset;
+}
+
+// the 32 hex chars to the 16 bytes
+size_t hexDecodeSSE2(char const* _hex, size_t _size, bcos::byte* _out, bool& _valid)
+{
+    size_t offset = 0;
+    auto valid = _mm_set1_epi8(-1);
+    auto lowByte = _mm_set1_epi16(0x00ff);
+    for (; offset + 32 <= _size; offset += 32)
+    {
+        auto first = charsToNibbles(_mm_loadu_si128((__m128i const*)(_hex + offset)), valid);
+        auto second =
+            charsToNibbles(_mm_loadu_si128((__m128i const*)(_hex + offset + 16)), valid);
+        // every 16-bit lane holds the high nibble in the low byte and the low nibble in the
+        // high byte
+        first = _mm_or_si128(
+            _mm_slli_epi16(_mm_and_si128(first, lowByte), 4), _mm_srli_epi16(first, 8));
+        second = _mm_or_si128(
+            _mm_slli_epi16(_mm_and_si128(second, lowByte), 4), _mm_srli_epi16(second, 8));
+        _mm_storeu_si128((__m128i*)(_out + offset / 2), _mm_packus_epi16(first, second));
+    }
+    _valid = (_mm_movemask_epi8(valid) == 0xffff);
+    return offset;
+}
+
+__attribute__((target("avx2"))) inline __m256i nibblesToCharsAVX2(__m256i _nibbles)
+{
+    auto letters =
+        _mm256_and_si256(_mm256_cmpgt_epi8(_nibbles, _mm256_set1_epi8(9)), _mm256_set1_epi8(39));
+    return _mm256_add_epi8(_mm256_add_epi8(_nibbles, _mm256_set1_epi8('0')), letters);
+}
+
+__attribute__((target("avx2"))) inline __m256i charsToNibblesAVX2(
+    __m256i _chars, __m256i& _valid)
+{
+    auto digits = _mm256_sub_epi8(_chars, _mm256_set1_epi8('0'));
+    auto isDigit = _mm256_andnot_si256(_mm256_cmpgt_epi8(_mm256_setzero_si256(), digits),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8(10), digits));
+    auto letters =
+        _mm256_sub_epi8(_mm256_or_si256(_chars, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    auto isLetter = _mm256_andnot_si256(_mm256_cmpgt_epi8(_mm256_setzero_si256(), letters),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8(6), letters));
+    _valid = _mm256_and_si256(_valid, _mm256_or_si256(isDigit, isLetter));
+    return _mm256_or_si256(_mm256_and_si256(isDigit, digits),
+        _mm256_and_si256(isLetter, _mm256_add_epi8(letters, _mm256_set1_epi8(10))));
+}
+
+// the 32 bytes to the 64 hex chars, the unpacking works within the 128-bit lanes
+__attribute__((target("avx2"))) size_t hexEncodeAVX2(bcos::byte const* _data, size_t _size, char* _out)
+{
+    size_t offset = 0;
+    auto mask = _mm256_set1_epi8(0x0f);
+    for (; offset + 32 <= _size; offset += 32)
+    {
+        auto input = _mm256_loadu_si256((__m256i const*)(_data + offset));
+        auto high = nibblesToCharsAVX2(_mm256_and_si256(_mm256_srli_epi16(input, 4), mask));
+        auto low = nibblesToCharsAVX2(_mm256_and_si256(input, mask));
+        auto first = _mm256_unpacklo_epi8(high, low);
+        auto second = _mm256_unpackhi_epi8(high, low);
+        _mm256_storeu_si256(
+            (__m256i*)(_out + 2 * offset), _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(
+            (__m256i*)(_out + 2 * offset + 32), _mm256_permute2x128_si256(first, second, 0x31));
+    }
+    return offset;
+}
+
+// the 64 hex chars to the 32 bytes, the packing works within the 128-bit lanes
+__attribute__((target("avx2"))) size_t hexDecodeAVX2(
+    char const* _hex, size_t _size, bcos::byte* _out, bool& _valid)
+{
+    size_t offset = 0;
+    auto valid = _mm256_set1_epi8(-1);
+    auto lowByte = _mm256_set1_epi16(0x00ff);
+    for (; offset + 64 <= _size; offset += 64)
+    {
+        auto first =
+            charsToNibblesAVX2(_mm256_loadu_si256((__m256i const*)(_hex + offset)), valid);
+        auto second =
+            charsToNibblesAVX2(_mm256_loadu_si256((__m256i const*)(_hex + offset + 32)), valid);
+        first = _mm256_or_si256(
+            _mm256_slli_epi16(_mm256_and_si256(first, lowByte), 4), _mm256_srli_epi16(first, 8));
+        second = _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(second, lowByte), 4),
+            _mm256_srli_epi16(second, 8));
+        auto packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(first, second), 0xd8);
+        _mm256_storeu_si256((__m256i*)(_out + offset / 2), packed);
+    }
+    _valid = ((uint32_t)_mm256_movemask_epi8(valid) == 0xffffffff);
+    return offset;
+}
+
+bool supportAVX2()
+{
+    static bool const support = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+    }();
+    return support;
+}
+#endif
+}  // namespace
+
+void bcos::hexEncode(bcos::byte const* _data, size_t _size, char* _out)
+{
+    size_t offset = 0;
+#ifdef BCOS_HEX_SIMD
+    if (supportAVX2())
+    {
+        offset = hexEncodeAVX2(_data, _size, _out);
+    }
+    offset += hexEncodeSSE2(_data + offset, _size - offset, _out + 2 * offset);
+#endif
+    hexEncodeScalar(_data + offset, _size - offset, _out + 2 * offset);
+}
+
+bool bcos::hexDecode(char const* _hex, size_t _size, bcos::byte* _out)
+{
+    size_t offset = 0;
+#ifdef BCOS_HEX_SIMD
+    bool valid = true;
+    if (supportAVX2())
+    {
+        offset = hexDecodeAVX2(_hex, _size, _out, valid);
+    }
+    bool sse2Valid = true;
+    offset += hexDecodeSSE2(_hex + offset, _size - offset, _out + offset / 2, sse2Valid);
+    if (!valid || !sse2Valid)
+    {
+        return false;
+    }
+#endif
+    return hexDecodeScalar(_hex + offset, _size - offset, _out + offset / 2);
+}
 /**
  * @brief: convert the hex char into the hex number
  *
@@ -73,15 +297,12 @@ std::shared_ptr<bytes> bcos::fromHexString(std::string const& _hexedString)
         }
         bytesData->push_back(h);
     }
-    for (unsigned i = startIndex; i < _hexedString.size(); i += 2)
+    auto offset = bytesData->size();
+    bytesData->resize(offset + (_hexedString.size() - startIndex) / 2);
+    if (!hexDecode(_hexedString.data() + startIndex, _hexedString.size() - startIndex,
+            bytesData->data() + offset))
     {
-        int highValue = convertCharToHexNumber(_hexedString[i]);
-        int lowValue = convertCharToHexNumber(_hexedString[i + 1]);
-        if (highValue == -1 || lowValue == -1)
-        {
-            BOOST_THROW_EXCEPTION(BadHexCharacter());
-        }
-        bytesData->push_back((bcos::byte)(highValue << 4) + lowValue);
+        BOOST_THROW_EXCEPTION(BadHexCharacter());
     }
     return bytesData;
 }
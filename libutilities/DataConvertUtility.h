@@ -21,6 +21,7 @@
 #include "Common.h"
 #include "Error.h"
 #include <boost/algorithm/hex.hpp>
+#include <boost/endian/conversion.hpp>
 #include <boost/throw_exception.hpp>
 #include <algorithm>
 #include <cstring>
@@ -32,10 +33,92 @@
 
 namespace bcos
 {
+/// whether the collection holds the bytes contiguously, e.g. bytes, std::string, std::array
+/// and bytesConstRef, which are converted through the kernels on the raw data
+template <class T, class = void>
+struct IsContiguousBytes : std::false_type
+{
+};
+template <class T>
+struct IsContiguousBytes<T, std::void_t<decltype(std::declval<T&>().data()),
+                                decltype(std::declval<T&>().size())>>
+  : std::bool_constant<sizeof(*std::declval<T&>().data()) == 1 &&
+                       std::is_integral_v<std::decay_t<decltype(*std::declval<T&>().data())>>>
+{
+};
+
+/**
+ * @brief hex-encode the bytes into the lower case hex chars, through the SSE2/AVX2 kernels
+ * when available
+ *
+ * @param _data : the bytes to be encoded
+ * @param _size : the size of the bytes
+ * @param _out : the buffer of at least 2 * _size chars to write the hex chars into
+ */
+void hexEncode(byte const* _data, size_t _size, char* _out);
+
+/**
+ * @brief hex-decode the hex chars of both cases into the bytes, through the SSE2/AVX2 kernels
+ * when available
+ *
+ * @param _hex : the hex chars to be decoded, the size of which must be even
+ * @param _size : the count of the hex chars
+ * @param _out : the buffer of at least _size / 2 bytes to write the decoded bytes into
+ * @return false if there are non-hex chars, the content of _out is unspecified then
+ */
+bool hexDecode(char const* _hex, size_t _size, byte* _out);
+
+/**
+ * @brief hex-encode the contiguous bytes into the preallocated buffer without the prefix
+ *
+ * @param _binary : the bytes to be encoded, e.g. bytes, bytesConstRef, std::string
+ * @param _out : the buffer of at least 2 * _binary.size() chars
+ * @return size_t : the count of the written hex chars
+ */
+template <class Binary>
+size_t toHexInto(const Binary& _binary, char* _out)
+{
+    static_assert(IsContiguousBytes<const Binary>::value, "only support contiguous bytes");
+    hexEncode((byte const*)_binary.data(), _binary.size(), _out);
+    return _binary.size() * 2;
+}
+
+/**
+ * @brief hex-decode the hex string with the given prefix into the preallocated buffer
+ *
+ * @param _hex : the hex string to be decoded, e.g. std::string, std::string_view
+ * @param _out : the buffer of at least (_hex.size() - _prefix.size()) / 2 bytes
+ * @param _prefix : the prefix of the hex string, e.g. 0x
+ * @return size_t : the count of the written bytes
+ */
+template <class Hex>
+size_t fromHexInto(
+    const Hex& _hex, byte* _out, const std::string_view& _prefix = std::string_view())
+{
+    static_assert(IsContiguousBytes<const Hex>::value, "only support contiguous hex chars");
+    if (_hex.size() < _prefix.size() || (_hex.size() - _prefix.size()) % 2 != 0)
+    {
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Invalid input hex string size"));
+    }
+    auto hexSize = _hex.size() - _prefix.size();
+    if (!hexDecode((char const*)_hex.data() + _prefix.size(), hexSize, _out))
+    {
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Invalid input hex string"));
+    }
+    return hexSize / 2;
+}
+
 template <class Binary, class Out = std::string>
 Out toHex(const Binary& binary, const std::string_view& prefix = std::string_view())
 {
     Out out;
+    if constexpr (IsContiguousBytes<const Binary>::value && IsContiguousBytes<Out>::value)
+    {
+        out.resize(binary.size() * 2 + prefix.size());
+        std::copy(prefix.begin(), prefix.end(), out.begin());
+        toHexInto(binary, (char*)out.data() + prefix.size());
+        return out;
+    }
 
     out.reserve(binary.size() * 2 + prefix.size());
 
@@ -67,6 +150,12 @@ Out fromHex(const Hex& hex, const std::string_view& prefix = std::string_view())
     }
 
     Out out;
+    if constexpr (IsContiguousBytes<const Hex>::value && IsContiguousBytes<Out>::value)
+    {
+        out.resize((hex.size() - prefix.size()) / 2);
+        fromHexInto(hex, (byte*)out.data(), prefix);
+        return out;
+    }
     out.reserve(hex.size() / 2);
 
     boost::algorithm::unhex(hex.begin() + prefix.size(), hex.end(), std::back_inserter(out));
@@ -92,6 +181,11 @@ std::shared_ptr<std::string> toHexString(
     std::shared_ptr<std::string> hexString = std::make_shared<std::string>(hexStringSize, '0');
     // set the _prefix
     memcpy((void*)hexString->data(), (const void*)_prefix.data(), _prefix.size());
+    if constexpr (std::is_pointer<Iterator>::value)
+    {
+        hexEncode((byte const*)_begin, _end - _begin, hexString->data() + _prefix.size());
+        return hexString;
+    }
     static char const* hexCharsCollection = "0123456789abcdef";
     // covert the bytes into hex chars
     size_t offset = _prefix.size();
@@ -113,7 +207,15 @@ std::shared_ptr<std::string> toHexString(
 template <class T>
 std::shared_ptr<std::string> toHexString(T const& _data)
 {
-    return toHexString(_data.begin(), _data.end());
+    if constexpr (IsContiguousBytes<const T>::value)
+    {
+        auto data = (byte const*)_data.data();
+        return toHexString(data, data + _data.size());
+    }
+    else
+    {
+        return toHexString(_data.begin(), _data.end());
+    }
 }
 
 /**
@@ -126,7 +228,15 @@ std::shared_ptr<std::string> toHexString(T const& _data)
 template <class T>
 std::string toHexStringWithPrefix(T const& _data)
 {
-    return *toHexString(_data.begin(), _data.end(), "0x");
+    if constexpr (IsContiguousBytes<const T>::value)
+    {
+        auto data = (byte const*)_data.data();
+        return *toHexString(data, data + _data.size(), "0x");
+    }
+    else
+    {
+        return *toHexString(_data.begin(), _data.end(), "0x");
+    }
 }
 
 /**
@@ -168,6 +278,100 @@ inline bytes asBytes(std::string const& _b)
 
 // Big-endian to/from host endian conversion functions.
 
+/// Converts the u256 to the 32 bytes big-endian data at @a _out limb by limb, every 64-bit limb
+/// is byte-swapped at once instead of shifting the whole number for every byte.
+inline void u256ToBigEndian(u256 const& _val, byte* _out)
+{
+    using limb_type = boost::multiprecision::limb_type;
+    if constexpr (sizeof(limb_type) == sizeof(uint64_t))
+    {
+        auto const& backend = _val.backend();
+        auto limbs = backend.limbs();
+        size_t limbSize = backend.size();
+        // the lowest limb is placed at the end of the big-endian data
+        for (size_t i = 0; i < 4; i++)
+        {
+            uint64_t limb = boost::endian::native_to_big(i < limbSize ? (uint64_t)limbs[i] : 0);
+            memcpy(_out + (3 - i) * sizeof(uint64_t), &limb, sizeof(uint64_t));
+        }
+    }
+    else
+    {
+        auto value = _val;
+        for (size_t i = 32; i != 0; value >>= 8, i--)
+        {
+            _out[i - 1] = (byte)(value & 0xff);
+        }
+    }
+}
+
+/// Converts the big-endian data of at most 32 bytes at @a _data to the u256 limb by limb, the
+/// data longer than 32 bytes is truncated to the lowest 32 bytes like the generic fromBigEndian.
+inline u256 u256FromBigEndian(byte const* _data, size_t _size)
+{
+    if (_size > 32)
+    {
+        _data += _size - 32;
+        _size = 32;
+    }
+    // the short data is right-aligned
+    byte buffer[32];
+    if (_size < 32)
+    {
+        memset(buffer, 0, 32 - _size);
+        memcpy(buffer + 32 - _size, _data, _size);
+        _data = buffer;
+    }
+    u256 ret;
+    using limb_type = boost::multiprecision::limb_type;
+    if constexpr (sizeof(limb_type) == sizeof(uint64_t))
+    {
+        auto& backend = ret.backend();
+        backend.resize(4, 4);
+        auto limbs = backend.limbs();
+        for (size_t i = 0; i < 4; i++)
+        {
+            uint64_t limb;
+            memcpy(&limb, _data + (3 - i) * sizeof(uint64_t), sizeof(uint64_t));
+            limbs[i] = (limb_type)boost::endian::big_to_native(limb);
+        }
+        backend.normalize();
+    }
+    else
+    {
+        boost::multiprecision::import_bits(ret, _data, _data + 32, 8, true);
+    }
+    return ret;
+}
+
+/// Converts the u256 list to the contiguous 32 bytes big-endian data at @a _out, which has the
+/// space of 32 * @a _values.size() bytes, e.g. the nonce list of the block.
+inline void u256sToBigEndian(std::vector<u256> const& _values, byte* _out)
+{
+    for (auto const& value : _values)
+    {
+        u256ToBigEndian(value, _out);
+        _out += 32;
+    }
+}
+
+/// Converts the contiguous 32 bytes big-endian data to the u256 list
+inline std::vector<u256> u256sFromBigEndian(bytesConstRef _data)
+{
+    if (_data.size() % 32 != 0)
+    {
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Invalid big-endian u256 list size"));
+    }
+    std::vector<u256> ret;
+    ret.reserve(_data.size() / 32);
+    for (size_t offset = 0; offset < _data.size(); offset += 32)
+    {
+        ret.emplace_back(u256FromBigEndian(_data.data() + offset, 32));
+    }
+    return ret;
+}
+
+
 /// Converts a templated integer value to the big-endian byte-stream represented on a templated
 /// collection. The size of the collection object will be unchanged. If it is too small, it will not
 /// represent the value properly, if too big then the additional elements will be zeroed out.
@@ -178,6 +382,16 @@ inline void toBigEndian(T _val, Out& o_out)
 {
     static_assert(std::is_same<bigint, T>::value || !std::numeric_limits<T>::is_signed,
         "only unsigned types or bigint supported");  // bigint does not carry sign bit on shift
+    if constexpr (std::is_same<u256, T>::value && IsContiguousBytes<Out>::value)
+    {
+        if (o_out.size() >= 32)
+        {
+            auto out = (byte*)o_out.data();
+            memset(out, 0, o_out.size() - 32);
+            u256ToBigEndian(_val, out + o_out.size() - 32);
+            return;
+        }
+    }
     for (auto i = o_out.size(); i != 0; _val >>= 8, i--)
     {
         T v = _val & (T)0xff;
@@ -192,6 +406,10 @@ inline void toBigEndian(T _val, Out& o_out)
 template <class T, class _In>
 inline T fromBigEndian(_In const& _bytes)
 {
+    if constexpr (std::is_same<u256, T>::value && IsContiguousBytes<_In const>::value)
+    {
+        return u256FromBigEndian((byte const*)_bytes.data(), _bytes.size());
+    }
     T ret = (T)0;
     for (auto i : _bytes)
         ret = (T)((ret << 8) | (byte)(typename std::make_unsigned<decltype(i)>::type)i);
@@ -201,7 +419,7 @@ inline T fromBigEndian(_In const& _bytes)
 inline bytes toBigEndian(u256 _val)
 {
     bytes ret(32);
-    toBigEndian(_val, ret);
+    u256ToBigEndian(_val, ret.data());
     return ret;
 }
 inline bytes toBigEndian(u160 _val)
@@ -55,6 +55,7 @@ private:
 DERIVE_BCOS_EXCEPTION(ConstructFixedBytesFailed);
 DERIVE_BCOS_EXCEPTION(BadCast);
 DERIVE_BCOS_EXCEPTION(BadHexCharacter);
+DERIVE_BCOS_EXCEPTION(BadBase64Data);
 DERIVE_BCOS_EXCEPTION(InvalidAddress);
 DERIVE_BCOS_EXCEPTION(InvalidParameter);
 
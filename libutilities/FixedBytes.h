@@ -151,23 +151,39 @@ public:
     }
     bool operator==(FixedBytes const& _comparedFixedBytes) const
     {
-        return m_data == _comparedFixedBytes.m_data;
+        // accumulate the differences of all the words without branches
+        uint64_t difference = 0;
+        for (unsigned index = 0; index < c_words; index++)
+        {
+            difference |= word(index) ^ _comparedFixedBytes.word(index);
+        }
+        for (unsigned index = c_words * sizeof(uint64_t); index < N; index++)
+        {
+            difference |= (uint64_t)(m_data[index] ^ _comparedFixedBytes.m_data[index]);
+        }
+        return difference == 0;
     }
     bool operator!=(FixedBytes const& _comparedFixedBytes) const
     {
-        return m_data != _comparedFixedBytes.m_data;
+        return !operator==(_comparedFixedBytes);
     }
     bool operator<(FixedBytes const& _comparedFixedBytes) const
     {
-        for (unsigned index = 0; index < N; index++)
+        // the lexicographical order of the bytes is the order of the big-endian words
+        for (unsigned index = 0; index < c_words; index++)
         {
-            if (m_data[index] < _comparedFixedBytes[index])
+            auto left = boost::endian::big_to_native(word(index));
+            auto right = boost::endian::big_to_native(_comparedFixedBytes.word(index));
+            if (left != right)
             {
-                return true;
+                return left < right;
             }
-            else if (m_data[index] > _comparedFixedBytes[index])
+        }
+        for (unsigned index = c_words * sizeof(uint64_t); index < N; index++)
+        {
+            if (m_data[index] != _comparedFixedBytes.m_data[index])
             {
-                return false;
+                return m_data[index] < _comparedFixedBytes.m_data[index];
             }
         }
         return false;
@@ -186,11 +202,7 @@ public:
     }
     FixedBytes& operator^=(FixedBytes const& _rightFixedBytes)
     {
-        for (unsigned index = 0; index < N; index++)
-        {
-            m_data[index] ^= _rightFixedBytes.m_data[index];
-        }
-        return *this;
+        return applyWords(_rightFixedBytes, [](auto _left, auto _right) { return _left ^ _right; });
     }
     FixedBytes operator^(FixedBytes const& _rightFixedBytes) const
     {
@@ -198,11 +210,7 @@ public:
     }
     FixedBytes& operator|=(FixedBytes const& _rightFixedBytes)
     {
-        for (unsigned index = 0; index < N; index++)
-        {
-            m_data[index] |= _rightFixedBytes.m_data[index];
-        }
-        return *this;
+        return applyWords(_rightFixedBytes, [](auto _left, auto _right) { return _left | _right; });
     }
     FixedBytes operator|(FixedBytes const& _rightFixedBytes) const
     {
@@ -210,11 +218,7 @@ public:
     }
     FixedBytes& operator&=(FixedBytes const& _rightFixedBytes)
     {
-        for (unsigned index = 0; index < N; index++)
-        {
-            m_data[index] &= _rightFixedBytes.m_data[index];
-        }
-        return *this;
+        return applyWords(_rightFixedBytes, [](auto _left, auto _right) { return _left & _right; });
     }
     FixedBytes operator&(FixedBytes const& _rightFixedBytes) const
     {
@@ -277,10 +281,23 @@ public:
 
     struct hash
     {
-        /// Make a hash of the object's data.
+        /// Make a hash of the object's data. The data is mostly a cryptographic hash already, so
+        /// only the first and the last 8 bytes are folded, the last ones keep the numbers and
+        /// the right-aligned data apart.
         size_t operator()(FixedBytes const& _value) const
         {
-            return boost::hash_range(_value.m_data.cbegin(), _value.m_data.cend());
+            if constexpr (N < sizeof(uint64_t))
+            {
+                return boost::hash_range(_value.m_data.cbegin(), _value.m_data.cend());
+            }
+            else
+            {
+                uint64_t first;
+                uint64_t last;
+                memcpy(&first, _value.data(), sizeof(uint64_t));
+                memcpy(&last, _value.data() + N - sizeof(uint64_t), sizeof(uint64_t));
+                return (size_t)(first ^ (last * 0x9e3779b97f4a7c15ULL));
+            }
         }
     };
 
@@ -340,6 +357,33 @@ public:
     void clear() { m_data.fill(0); }
 
 private:
+    // the count of the whole 64-bit words in the data
+    static constexpr unsigned c_words = N / sizeof(uint64_t);
+
+    // the 64-bit word at the index in the native order, loaded without the alignment
+    uint64_t word(unsigned _index) const
+    {
+        uint64_t value;
+        memcpy(&value, m_data.data() + _index * sizeof(uint64_t), sizeof(uint64_t));
+        return value;
+    }
+
+    // apply the bitwise operation word by word, the fixed-size loop is vectorized by the compiler
+    template <class Operation>
+    FixedBytes& applyWords(FixedBytes const& _rightFixedBytes, Operation&& _operation)
+    {
+        for (unsigned index = 0; index < c_words; index++)
+        {
+            uint64_t value = _operation(word(index), _rightFixedBytes.word(index));
+            memcpy(m_data.data() + index * sizeof(uint64_t), &value, sizeof(uint64_t));
+        }
+        for (unsigned index = c_words * sizeof(uint64_t); index < N; index++)
+        {
+            m_data[index] = (byte)_operation(m_data[index], _rightFixedBytes.m_data[index]);
+        }
+        return *this;
+    }
+
     void constructFixedBytes(bytesConstRef _bytesData, DataAlignType _alignType)
     {
         m_data.fill(0);
@@ -481,7 +525,7 @@ public:
     }
     SecureFixedBytes& operator|=(FixedBytes<T> const& _c)
     {
-        static_cast<FixedBytes<T>&>(*this).operator^=(_c);
+        static_cast<FixedBytes<T>&>(*this).operator|=(_c);
         return *this;
     }
     SecureFixedBytes operator|(FixedBytes<T> const& _c) const
@@ -490,7 +534,7 @@ public:
     }
     SecureFixedBytes& operator&=(FixedBytes<T> const& _c)
     {
-        static_cast<FixedBytes<T>&>(*this).operator^=(_c);
+        static_cast<FixedBytes<T>&>(*this).operator&=(_c);
         return *this;
     }
     SecureFixedBytes operator&(FixedBytes<T> const& _c) const
@@ -509,7 +553,7 @@ public:
     }
     SecureFixedBytes& operator|=(SecureFixedBytes const& _c)
     {
-        static_cast<FixedBytes<T>&>(*this).operator^=(static_cast<FixedBytes<T> const&>(_c));
+        static_cast<FixedBytes<T>&>(*this).operator|=(static_cast<FixedBytes<T> const&>(_c));
         return *this;
     }
     SecureFixedBytes operator|(SecureFixedBytes const& _c) const
@@ -518,7 +562,7 @@ public:
     }
     SecureFixedBytes& operator&=(SecureFixedBytes const& _c)
     {
-        static_cast<FixedBytes<T>&>(*this).operator^=(static_cast<FixedBytes<T> const&>(_c));
+        static_cast<FixedBytes<T>&>(*this).operator&=(static_cast<FixedBytes<T> const&>(_c));
         return *this;
     }
     SecureFixedBytes operator&(SecureFixedBytes const& _c) const
@@ -547,24 +591,6 @@ public:
     void clear() { ref().cleanMemory(); }
 };
 
-/// Fast equality operator for h256.
-template <>
-inline bool FixedBytes<32>::operator==(FixedBytes<32> const& _other) const
-{
-    const uint64_t* hash1 = (const uint64_t*)data();
-    const uint64_t* hash2 = (const uint64_t*)_other.data();
-    return (hash1[0] == hash2[0]) && (hash1[1] == hash2[1]) && (hash1[2] == hash2[2]) &&
-           (hash1[3] == hash2[3]);
-}
-
-/// Fast std::hash compatible hash function object for h256.
-template <>
-inline size_t FixedBytes<32>::hash::operator()(FixedBytes<32> const& value) const
-{
-    uint64_t const* data = reinterpret_cast<uint64_t const*>(value.data());
-    return boost::hash_range(data, data + 4);
-}
-
 /// Stream I/O for the FixedBytes class.
 template <unsigned N>
 inline std::ostream& operator<<(std::ostream& _out, FixedBytes<N> const& _h)
@@ -23,6 +23,7 @@
 #pragma once
 #include "Common.h"
 #include <boost/asio.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/thread/thread.hpp>
 #include <iosfwd>
 #include <memory>
@@ -64,6 +65,23 @@ public:
         _ioService.post(f);
     }
 
+    // Add new work item to the pool, the item will be executed after _delayMs milliseconds
+    template <class F>
+    void enqueueAfter(uint64_t _delayMs, F f)
+    {
+        auto timer = std::make_shared<boost::asio::steady_timer>(
+            _ioService, std::chrono::milliseconds(_delayMs));
+        // the timer should be kept alive until the handler has been called
+        timer->async_wait([timer, f](boost::system::error_code const& _error) {
+            // the pool has been stopped
+            if (_error)
+            {
+                return;
+            }
+            f();
+        });
+    }
+
 private:
     std::string _threadName;
     boost::thread_group _workers;
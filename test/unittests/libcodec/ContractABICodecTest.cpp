@@ -17,6 +17,7 @@
  * @author: octopuswang
  * @date: 2019-04-01
  */
+#include "libcodec/abi/ABISelectorTable.h"
 #include "libcodec/abi/ContractABICodec.h"
 #include "libcodec/abi/ContractABIType.h"
 #include "testutils/TestPromptFixture.h"
@@ -869,6 +870,170 @@ BOOST_AUTO_TEST_CASE(testABITuple)
     }
 }
 
+BOOST_AUTO_TEST_CASE(ContractABICodecInPlace)
+{
+    auto hashImpl = std::make_shared<Keccak256Hash>();
+    ContractABICodec ct(hashImpl);
+    // the tuple with the static array is encoded with the offsets after the whole head
+    std::array<u256, 2> staticArray = {u256(1), u256(2)};
+    auto tuple = std::make_tuple(u256(3), staticArray, std::string("abc"), bytes(40, 0x12));
+    std::vector<std::string> strs = {"a", std::string(33, 'b'), ""};
+    auto encoded = ct.abiIn("set(uint256)", tuple, strs, staticArray, true, s256(-1));
+    BOOST_CHECK(encoded.size() % 32 == 4);
+
+    decltype(tuple) outTuple;
+    std::vector<std::string> outStrs;
+    std::array<u256, 2> outArray;
+    bool outBool = false;
+    s256 outValue;
+    BOOST_CHECK(ct.abiOut(bytesConstRef(encoded.data() + 4, encoded.size() - 4), outTuple,
+        outStrs, outArray, outBool, outValue));
+    BOOST_CHECK(outTuple == tuple);
+    BOOST_CHECK(outStrs == strs);
+    BOOST_CHECK(outArray == staticArray);
+    BOOST_CHECK(outBool);
+    BOOST_CHECK(outValue == s256(-1));
+
+    // the nested elements are encoded the same as serialise
+    auto encodedTuple = ct.serialise(tuple);
+    // the head: the offsets of the tuple and strs, staticArray, the bool and the s256
+    auto tupleBegin = encoded.begin() + 4 + 6 * 32;
+    BOOST_CHECK(bytes(tupleBegin, tupleBegin + encodedTuple.size()) == encodedTuple);
+
+    size_t count = 100000;
+    std::vector<u256> values(10, u256(12345));
+    Address address("0x692a70d2e424a56d2c6c27aa97d1a86395877b3a");
+    auto startT = utcSteadyTime();
+    size_t encodedSize = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        encodedSize += ct.abiIn("transfer(address,uint256,string,uint256[])", address, u256(i),
+                             std::string(64, 'a'), values)
+                           .size();
+    }
+    std::cout << "#### abiIn " << count << " calls, size: " << encodedSize
+              << ", cost: " << utcSteadyTime() - startT << "ms" << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(ContractABI_DecodeViews)
+{
+    auto hashImpl = std::make_shared<Keccak256Hash>();
+    ContractABICodec ct(hashImpl);
+    std::string s = "test string";
+    bytes b(40, 0x12);
+    u256 u = 111111111;
+    auto in = ct.abiIn("", s, u, b);
+
+    // the string and bytes are decoded as views into the input
+    std::string_view outS;
+    u256 outU;
+    bytesConstRef outB;
+    BOOST_CHECK(ct.abiOut(bytesConstRef(&in), outS, outU, outB));
+    BOOST_CHECK(outS == s);
+    BOOST_CHECK(outU == u);
+    BOOST_CHECK(outB.toBytes() == b);
+    BOOST_CHECK(outB.data() >= in.data() && outB.data() + outB.size() <= in.data() + in.size());
+    // the views are encoded the same as the owned data
+    BOOST_CHECK(ct.abiIn("", outS, outU, outB) == in);
+
+    // the length exceeding the data
+    auto invalidIn = in;
+    invalidIn[32 * 3 + 31] = 0xff;
+    BOOST_CHECK(!ct.abiOut(bytesConstRef(&invalidIn), outS, outU, outB));
+    invalidIn = in;
+    std::fill(invalidIn.begin() + 32 * 3, invalidIn.begin() + 32 * 4, 0xff);
+    BOOST_CHECK(!ct.abiOut(bytesConstRef(&invalidIn), outS, outU, outB));
+}
+
+BOOST_AUTO_TEST_CASE(ContractABI_AbiOutByParsedFunc)
+{
+    auto hashImpl = std::make_shared<Keccak256Hash>();
+    ContractABICodec ct(hashImpl);
+    Address address("0x692a70d2e424a56d2c6c27aa97d1a86395877b3a");
+    auto in = ct.abiIn("", std::string("aaaaaaa"), u256(111111111), s256(-11111111), address);
+
+    // the function is parsed once, and decoded by the parsed types
+    ABIFunc afunc;
+    BOOST_CHECK(afunc.parser("test(string,uint64,int32,address)"));
+    std::vector<std::string> allOut;
+    BOOST_CHECK(ct.abiOutByFuncSelector(bytesConstRef(&in), afunc, allOut));
+    std::vector<std::string> expected = {"aaaaaaa", "111111111", "-11111111", address.hex()};
+    BOOST_CHECK(allOut == expected);
+
+    // the same result as decoding by the type strings
+    std::vector<std::string> allOutByTypes;
+    BOOST_CHECK(ct.abiOutByFuncSelector(
+        bytesConstRef(&in), {"string", "uint256", "int256", "address"}, allOutByTypes));
+    BOOST_CHECK(allOutByTypes == expected);
+
+    // unsupported types
+    ABIFunc arrayFunc;
+    BOOST_CHECK(arrayFunc.parser("test(uint256[])"));
+    allOut.clear();
+    BOOST_CHECK(!ct.abiOutByFuncSelector(bytesConstRef(&in), arrayFunc, allOut));
+    ABIFunc boolFunc;
+    BOOST_CHECK(boolFunc.parser("test(bool)"));
+    BOOST_CHECK(!ct.abiOutByFuncSelector(bytesConstRef(&in), boolFunc, allOut));
+}
+
+BOOST_AUTO_TEST_CASE(ContractABI_SelectorTable)
+{
+    auto hashImpl = std::make_shared<Keccak256Hash>();
+    ContractABICodec ct(hashImpl);
+    ABISelectorTable table(hashImpl);
+    BOOST_CHECK(table.getFunction(0) == nullptr);
+    BOOST_CHECK(table.registerFunction("insert(string, string)"));
+    BOOST_CHECK(table.registerFunction("select(string,uint256[2],int256)"));
+    BOOST_CHECK(table.registerFunction("remove(address)"));
+    // the duplicated and the invalid signatures
+    BOOST_CHECK(!table.registerFunction("insert(string,string)"));
+    BOOST_CHECK(!table.registerFunction("update(string,uint25)"));
+    BOOST_CHECK(table.size() == 3);
+
+    // the parameters head with the static array
+    auto in = ct.abiIn("select(string,uint256[2],int256)", std::string("t_test"),
+        std::array<u256, 2>{1, 2}, s256(-100));
+    auto func = table.getFunction(bytesConstRef(&in));
+    BOOST_REQUIRE(func != nullptr);
+    BOOST_CHECK(func->getSignature() == "select(string,uint256[2],int256)");
+    std::vector<std::size_t> headOffset = {0, 32, 96};
+    BOOST_CHECK(func->getParamsHeadOffset() == headOffset);
+    BOOST_CHECK(func->getParamsHeadSize() == 128);
+
+    in = ct.abiIn("insert(string,string)", std::string("t_test"), std::string("value"));
+    func = table.getFunction(bytesConstRef(&in));
+    BOOST_REQUIRE(func != nullptr);
+    std::vector<std::string> allOut;
+    BOOST_CHECK(ct.abiOutByFuncSelector(
+        bytesConstRef(in.data() + 4, in.size() - 4), *func, allOut));
+    std::vector<std::string> expected = {"t_test", "value"};
+    BOOST_CHECK(allOut == expected);
+    // the truncated parameters
+    allOut.clear();
+    BOOST_CHECK_THROW(ct.abiOutByFuncSelector(bytesConstRef(in.data() + 4, 32), *func, allOut),
+        std::length_error);
+
+    // the unregistered selector and the short call data
+    in = ct.abiIn("update(string)", std::string("t_test"));
+    BOOST_CHECK(table.getFunction(bytesConstRef(&in)) == nullptr);
+    BOOST_CHECK(table.getFunction(bytesConstRef(in.data(), 3)) == nullptr);
+
+    // all the registered functions can be found
+    ABISelectorTable largeTable(hashImpl);
+    for (size_t i = 0; i < 300; i++)
+    {
+        BOOST_CHECK(largeTable.registerFunction("f" + std::to_string(i) + "(uint256)"));
+    }
+    for (size_t i = 0; i < 300; i++)
+    {
+        auto signature = "f" + std::to_string(i) + "(uint256)";
+        auto registeredFunc = largeTable.getFunction(largeTable.selector(signature));
+        BOOST_REQUIRE(registeredFunc != nullptr);
+        BOOST_CHECK(registeredFunc->getSignature() == signature);
+    }
+    BOOST_CHECK(largeTable.getFunction(largeTable.selector("f300(uint256)")) == nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace bcos
\ No newline at end of file
@@ -1071,6 +1071,184 @@ BOOST_AUTO_TEST_CASE(tests256)
     printData((s256)-123123122147483649);
     std::cout << "##### s256 test end" << std::endl;
 }
+BOOST_AUTO_TEST_CASE(testEncoderBuffer)
+{
+    // the byte collections and integer collections are encoded with one copy
+    ScaleEncoderStream encoder;
+    encoder << std::vector<uint32_t>{1, 2} << std::string("abc") << bytes(64, 0xff);
+    bytes expected = {0x08, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 'a', 'b', 'c',
+        0x01, 0x01};
+    expected.insert(expected.end(), 64, 0xff);
+    BOOST_CHECK(encoder.data() == expected);
+    BOOST_CHECK(encoder.size() == expected.size());
+    BOOST_CHECK(encoder.take() == expected);
+    BOOST_CHECK(encoder.size() == 0);
+
+    h256 hash(1234);
+    auto hashData = hash.asBytes();
+    BOOST_CHECK(encode(hash) == encode(hashData));
+    BOOST_CHECK(decode<h256>(encode(hash)) == hash);
+
+    // the caller-provided buffer
+    bytes buffer(expected.size());
+    ScaleEncoderStream bufferEncoder(buffer.data(), buffer.size());
+    bufferEncoder << std::vector<uint32_t>{1, 2} << std::string("abc") << bytes(64, 0xff);
+    BOOST_CHECK(buffer == expected);
+    BOOST_CHECK(bufferEncoder.data() == expected);
+    BOOST_CHECK_THROW(bufferEncoder << (uint8_t)1, ScaleEncodeException);
+}
+BOOST_AUTO_TEST_CASE(testEncoderPerf)
+{
+    size_t count = 100000;
+    bytes output(100, 0x12);
+    std::string address(20, 'a');
+    u256 gasUsed = 12343242342;
+    std::vector<bytes> topics(3, bytes(32, 0x34));
+
+    auto startT = utcSteadyTime();
+    size_t encodedSize = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        ScaleEncoderStream encoder;
+        encoder << (int32_t)i << output << address << gasUsed << topics << (int64_t)i;
+        encodedSize += encoder.take().size();
+    }
+    std::cout << "#### encode " << count << " receipt-like records, size: " << encodedSize
+              << ", cost: " << utcSteadyTime() - startT << "ms" << std::endl;
+
+    std::vector<bytes> leaves(count, bytes(40, 0x56));
+    startT = utcSteadyTime();
+    auto encodedData = encode(leaves);
+    std::cout << "#### encode " << count << " 40-bytes items, size: " << encodedData.size()
+              << ", cost: " << utcSteadyTime() - startT << "ms" << std::endl;
+
+    std::vector<uint64_t> weights(count * 10, 100);
+    startT = utcSteadyTime();
+    encodedData = encode(weights);
+    std::cout << "#### encode " << count * 10 << " uint64_t, size: " << encodedData.size()
+              << ", cost: " << utcSteadyTime() - startT << "ms" << std::endl;
+    BOOST_CHECK(decode<std::vector<uint64_t>>(encodedData) == weights);
+}
+BOOST_AUTO_TEST_CASE(testDecoderViews)
+{
+    bytes data(64, 0xff);
+    std::string str = "abc";
+    h256 hash(1234);
+    u256 value = 123456789;
+    std::vector<int64_t> numbers = {-1, 0, 1, INT64_MAX};
+    ScaleEncoderStream encoder;
+    encoder << data << str << hash << value << numbers;
+    auto encodedData = encoder.take();
+
+    // decode the byte collections as views into the encoded data
+    ScaleDecoderStream decoder(encodedData);
+    bytesConstRef dataView;
+    std::string_view strView;
+    h256 decodedHash;
+    u256 decodedValue;
+    std::vector<int64_t> decodedNumbers;
+    decoder >> dataView >> strView >> decodedHash >> decodedValue >> decodedNumbers;
+    BOOST_CHECK(dataView.toBytes() == data);
+    BOOST_CHECK(dataView.data() == encodedData.data() + 2);
+    BOOST_CHECK(strView == str);
+    BOOST_CHECK(decodedHash == hash);
+    BOOST_CHECK(decodedValue == value);
+    BOOST_CHECK(decodedNumbers == numbers);
+    BOOST_CHECK(!decoder.hasMore(1));
+
+    // the truncated data
+    for (size_t size : {(size_t)1, (size_t)66, (size_t)100, encodedData.size() - 1})
+    {
+        ScaleDecoderStream truncatedDecoder(gsl::span<const byte>(encodedData.data(), size));
+        bytes decodedData;
+        std::string decodedStr;
+        BOOST_CHECK_THROW(
+            truncatedDecoder >> decodedData >> decodedStr >> decodedHash >> decodedValue >>
+                decodedNumbers,
+            ScaleDecodeException);
+    }
+    // the collection size exceeds the data
+    bytes invalidData = {0xfe, 0xff, 0xff, 0xff, 0x01};
+    BOOST_CHECK_THROW(decode<bytes>(invalidData), ScaleDecodeException);
+    BOOST_CHECK_THROW(decode<std::vector<uint32_t>>(invalidData), ScaleDecodeException);
+}
+BOOST_AUTO_TEST_CASE(testEncodedSize)
+{
+    static_assert(ScaleStaticSize<h256>::value == 33);
+    static_assert(ScaleStaticSize<std::array<uint32_t, 4>>::value == 16);
+    static_assert(ScaleStaticSize<std::pair<int64_t, h256>>::value == 41);
+    static_assert(ScaleStaticSize<bytes>::value == 0);
+    static_assert(compactLengthSize(63) == 1 && compactLengthSize(64) == 2);
+
+    // the compact length prefix calculated at compile time
+    auto prefix = compactLengthPrefix<63>();
+    BOOST_CHECK(bytes(prefix.begin(), prefix.end()) == encode(CompactInteger(63)));
+    auto prefix2 = compactLengthPrefix<64>();
+    BOOST_CHECK(bytes(prefix2.begin(), prefix2.end()) == encode(CompactInteger(64)));
+    auto prefix4 = compactLengthPrefix<16384>();
+    BOOST_CHECK(bytes(prefix4.begin(), prefix4.end()) == encode(CompactInteger(16384)));
+    auto bigPrefix = compactLengthPrefix<(1ul << 30)>();
+    BOOST_CHECK(bytes(bigPrefix.begin(), bigPrefix.end()) == encode(CompactInteger(1ul << 30)));
+    for (size_t length : {0ul, 63ul, 64ul, 16383ul, 16384ul, (1ul << 30) - 1, 1ul << 30, 1ul << 40})
+    {
+        BOOST_CHECK(compactLengthSize(length) == encode(CompactInteger(length)).size());
+    }
+
+    // the encoded size of the value tree
+    std::vector<bytes> sealerList(3, bytes(64, 0x01));
+    std::vector<h256> hashes(100, h256(1));
+    std::map<std::string, std::vector<int64_t>> map = {{"a", {1, 2}}, {"bcd", {}}};
+    boost::optional<bool> optionalBool = true;
+    boost::optional<u256> optionalValue = u256(100);
+    boost::variant<uint8_t, std::string> variant = std::string("abc");
+    auto tuple = std::make_tuple((int32_t)1, std::string(70, 'a'), s256(-1), CompactInteger(1) << 40);
+    auto ptr = std::make_shared<std::vector<std::string>>(2, "abc");
+    std::array<bytes, 2> array = {bytes(10), bytes(100)};
+    BOOST_CHECK(scaleEncodedSize(sealerList, hashes, map) == encode(sealerList, hashes, map).size());
+    BOOST_CHECK(scaleEncodedSize(optionalBool, optionalValue, variant, tuple) ==
+                encode(optionalBool, optionalValue, variant, tuple).size());
+    BOOST_CHECK(scaleEncodedSize(ptr, array) == encode(ptr, array).size());
+    std::vector<uint8_t> largeData(20000);
+    BOOST_CHECK(scaleEncodedSize(largeData) == encode(largeData).size());
+
+    // the FixedBytes encoded with the non-canonical length is still decodable
+    bytes longerData(40, 0x12);
+    auto decodedHash = decode<h256>(encode(longerData));
+    BOOST_CHECK(decodedHash == h256(bytes(32, 0x12)));
+    BOOST_CHECK_THROW(decode<h256>(encode(bytes(31, 0x12))), ScaleDecodeException);
+}
+BOOST_AUTO_TEST_CASE(testDecoderPerf)
+{
+    size_t count = 100000;
+    std::vector<bytes> encodedRecords;
+    for (size_t i = 0; i < count; i++)
+    {
+        ScaleEncoderStream encoder;
+        encoder << (int32_t)i << bytes(100, 0x12) << std::string(20, 'a') << u256(i)
+                << std::vector<h256>(3, h256(i)) << (int64_t)i;
+        encodedRecords.emplace_back(encoder.take());
+    }
+    auto startT = utcSteadyTime();
+    for (auto const& record : encodedRecords)
+    {
+        ScaleDecoderStream decoder(record);
+        int32_t status;
+        bytes output;
+        std::string address;
+        u256 gasUsed;
+        std::vector<h256> topics;
+        int64_t number;
+        decoder >> status >> output >> address >> gasUsed >> topics >> number;
+    }
+    std::cout << "#### decode " << count << " receipt-like records, cost: "
+              << utcSteadyTime() - startT << "ms" << std::endl;
+
+    auto encodedData = encode(std::vector<uint64_t>(count * 10, 100));
+    startT = utcSteadyTime();
+    auto weights = decode<std::vector<uint64_t>>(encodedData);
+    std::cout << "#### decode " << weights.size()
+              << " uint64_t, cost: " << utcSteadyTime() - startT << "ms" << std::endl;
+}
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace bcos
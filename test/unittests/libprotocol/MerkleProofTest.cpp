@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief test for the merkle root and the merkle proof
+ * @file MerkleProofTest.cpp
+ * @author: yujiechen
+ * @date: 2021-10-18
+ */
+#include "../../../testutils/TestPromptFixture.h"
+#include "libprotocol/MerkleTree.h"
+#include "libprotocol/ParallelMerkleProof.h"
+#include "testutils/protocol/FakeBlock.h"
+#include <boost/test/unit_test.hpp>
+
+using namespace bcos;
+using namespace bcos::crypto;
+using namespace bcos::protocol;
+
+namespace bcos
+{
+namespace test
+{
+BOOST_FIXTURE_TEST_SUITE(MerkleProofTest, TestPromptFixture)
+// the merkle root calculated level by level with the concatenated children
+HashType calculateMerkleRootByLevel(CryptoSuite::Ptr _cryptoSuite, std::vector<bytes> _leaves)
+{
+    if (_leaves.empty())
+    {
+        return _cryptoSuite->hash(bytes());
+    }
+    while (_leaves.size() > 1)
+    {
+        std::vector<bytes> parents;
+        for (size_t i = 0; i < _leaves.size(); i += 16)
+        {
+            bytes childrenData;
+            for (size_t j = i; j < std::min(i + 16, _leaves.size()); j++)
+            {
+                childrenData.insert(childrenData.end(), _leaves[j].begin(), _leaves[j].end());
+            }
+            parents.emplace_back(_cryptoSuite->hash(childrenData).asBytes());
+        }
+        _leaves = std::move(parents);
+    }
+    return _cryptoSuite->hash(_leaves[0]);
+}
+
+std::vector<bytes> fakeMerkleLeaves(CryptoSuite::Ptr _cryptoSuite, size_t _size)
+{
+    std::vector<bytes> leaves;
+    for (size_t i = 0; i < _size; i++)
+    {
+        // the leaves with different length
+        auto leaf = _cryptoSuite->hash(std::to_string(i)).asBytes();
+        leaf.resize(leaf.size() + i % 5, (byte)i);
+        leaves.emplace_back(std::move(leaf));
+    }
+    return leaves;
+}
+
+BOOST_AUTO_TEST_CASE(testMerkleProofRoot)
+{
+    auto cryptoSuite = createNormalCryptoSuite();
+    for (auto size : {0, 1, 2, 15, 16, 17, 256, 257, 1000, 4097})
+    {
+        auto leaves = fakeMerkleLeaves(cryptoSuite, size);
+        auto expectedRoot = calculateMerkleRootByLevel(cryptoSuite, leaves);
+        BOOST_CHECK(calculateMerkleProofRoot(cryptoSuite, leaves) == expectedRoot);
+        // the leaves are not modified
+        BOOST_CHECK(leaves == fakeMerkleLeaves(cryptoSuite, size));
+
+        auto parent2ChildList = std::make_shared<std::map<std::string, std::vector<std::string>>>();
+        calculateMerkleProof(cryptoSuite, leaves, parent2ChildList);
+        BOOST_CHECK(leaves == fakeMerkleLeaves(cryptoSuite, size));
+        if (size > 0)
+        {
+            BOOST_CHECK(parent2ChildList->count(*toHexString(expectedRoot)));
+        }
+
+        MerkleTree merkleTree(cryptoSuite);
+        merkleTree.setLeaves(std::move(leaves));
+        BOOST_CHECK(merkleTree.root() == expectedRoot);
+    }
+}
+BOOST_AUTO_TEST_CASE(testMerkleTreeProof)
+{
+    auto cryptoSuite = createNormalCryptoSuite();
+    for (auto size : {1, 2, 16, 17, 300, 4097})
+    {
+        auto leaves = fakeMerkleLeaves(cryptoSuite, size);
+        MerkleTree merkleTree(cryptoSuite);
+        merkleTree.setLeaves(std::vector<bytes>(leaves));
+        auto root = merkleTree.root();
+        for (size_t i = 0; i < leaves.size(); i += 7)
+        {
+            auto proof = merkleTree.proof(i);
+            BOOST_CHECK(MerkleTree::verifyProof(cryptoSuite, root, ref(leaves[i]), proof));
+            auto encodedProof = MerkleTree::encodeProof(proof);
+            auto decodedProof = MerkleTree::decodeProof(ref(encodedProof));
+            BOOST_CHECK(MerkleTree::verifyProof(cryptoSuite, root, ref(leaves[i]), decodedProof));
+            // the proof of the other leaf
+            auto otherLeaf = leaves[(i + 1) % leaves.size()];
+            if (leaves.size() > 1)
+            {
+                BOOST_CHECK(!MerkleTree::verifyProof(cryptoSuite, root, ref(otherLeaf), proof));
+            }
+            // the modified proof
+            if (!proof.siblings.empty())
+            {
+                proof.siblings.back().emplace_back(cryptoSuite->hash(leaves[i]));
+                BOOST_CHECK(!MerkleTree::verifyProof(cryptoSuite, root, ref(leaves[i]), proof));
+            }
+        }
+    }
+    MerkleTree merkleTree(cryptoSuite);
+    BOOST_CHECK_THROW(merkleTree.proof(0), InvalidParameter);
+}
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace bcos
@@ -21,6 +21,7 @@
 #include "../../../testutils/TestPromptFixture.h"
 #include "libprotocol/TransactionSubmitResultFactoryImpl.h"
 #include "libprotocol/TransactionSubmitResultImpl.h"
+#include "libprotocol/protobuf/PBBlockStreamCodec.h"
 #include "testutils/protocol/FakeBlock.h"
 #include <boost/test/unit_test.hpp>
 #include <memory>
@@ -144,6 +145,229 @@ BOOST_AUTO_TEST_CASE(testSMBlock)
     auto blockFactory = createBlockFactory(cryptoSuite);
     testBlock(cryptoSuite, blockFactory);
 }
+BOOST_AUTO_TEST_CASE(testArenaBlock)
+{
+    auto cryptoSuite = createNormalCryptoSuite();
+    auto blockFactory = createBlockFactory(cryptoSuite);
+    std::dynamic_pointer_cast<PBBlockFactory>(blockFactory)->setUseArena(true);
+    testBlock(cryptoSuite, blockFactory);
+
+    // the transactions and receipts decoded into the arena outlive the block
+    auto block = fakeAndCheckBlock(cryptoSuite, blockFactory, true, 10, 10);
+    auto encodedData = std::make_shared<bytes>();
+    block->encode(*encodedData);
+    auto decodedBlock = blockFactory->createBlock(*encodedData);
+    BOOST_CHECK(std::dynamic_pointer_cast<PBBlock>(decodedBlock)->useArena());
+    auto tx = decodedBlock->transaction(0);
+    auto receipt = decodedBlock->receipt(0);
+    auto txMetaData = decodedBlock->transactionMetaData(0);
+    decodedBlock.reset();
+    BOOST_CHECK(tx->hash() == block->transaction(0)->hash());
+    BOOST_CHECK(tx->input().toBytes() == block->transaction(0)->input().toBytes());
+    BOOST_CHECK(receipt->hash() == block->receipt(0)->hash());
+    BOOST_CHECK(txMetaData->hash() == block->transactionMetaData(0)->hash());
+    BOOST_CHECK(txMetaData->to() == block->transactionMetaData(0)->to());
+}
+BOOST_AUTO_TEST_CASE(testLazyDecodeBlock)
+{
+    auto cryptoSuite = createNormalCryptoSuite();
+    auto blockFactory = createBlockFactory(cryptoSuite);
+    auto pbBlockFactory = std::dynamic_pointer_cast<PBBlockFactory>(blockFactory);
+    pbBlockFactory->setLazyDecodeTransactions(true);
+    testBlock(cryptoSuite, blockFactory);
+    pbBlockFactory->setUseArena(true);
+    testBlock(cryptoSuite, blockFactory);
+
+    auto block = fakeAndCheckBlock(cryptoSuite, blockFactory, true, 10, 10);
+    auto encodedData = std::make_shared<bytes>();
+    block->encode(*encodedData);
+    // forward the lazily decoded block without touching the transactions
+    auto decodedBlock = std::dynamic_pointer_cast<PBBlock>(blockFactory->createBlock(*encodedData));
+    BOOST_CHECK(decodedBlock->lazyDecodeTransactions());
+    BOOST_CHECK(decodedBlock->transactionsSize() == 10);
+    bytes forwardedData;
+    decodedBlock->encode(forwardedData);
+    BOOST_CHECK(forwardedData == *encodedData);
+    // decode the transactions on access
+    BOOST_CHECK(decodedBlock->transaction(3)->hash() == block->transaction(3)->hash());
+    decodedBlock->decodeAllTransactions();
+    BOOST_CHECK(decodedBlock->calculateTransactionRoot() == block->calculateTransactionRoot());
+    BOOST_CHECK(decodedBlock->transaction(10) == nullptr);
+    // append transaction to the lazily decoded block
+    decodedBlock = std::dynamic_pointer_cast<PBBlock>(blockFactory->createBlock(*encodedData));
+    decodedBlock->appendTransaction(fakeTransaction(cryptoSuite));
+    BOOST_CHECK(decodedBlock->transactionsSize() == 11);
+    for (size_t i = 0; i < 10; i++)
+    {
+        BOOST_CHECK(decodedBlock->transaction(i)->hash() == block->transaction(i)->hash());
+    }
+}
+BOOST_AUTO_TEST_CASE(testBatchVerifyTransactions)
+{
+    auto cryptoSuite = createNormalCryptoSuite();
+    auto blockFactory = createBlockFactory(cryptoSuite);
+    auto block = blockFactory->createBlock();
+    Transactions txs;
+    for (size_t i = 0; i < 10; i++)
+    {
+        auto tx = fakeTransaction(cryptoSuite, utcTime() + i);
+        block->appendTransaction(tx);
+        txs.emplace_back(tx);
+    }
+    auto encodedData = std::make_shared<bytes>();
+    block->encode(*encodedData);
+    auto decodedBlock = blockFactory->createBlock(*encodedData, true, true);
+    for (size_t i = 0; i < txs.size(); i++)
+    {
+        BOOST_CHECK(decodedBlock->transaction(i)->sender() == txs[i]->sender());
+    }
+    // the verified transactions are skipped
+    BOOST_CHECK(verifyTransactions(cryptoSuite, txs).empty());
+
+    // the transaction with invalid signature
+    auto keyPair = cryptoSuite->signatureImpl()->generateKeyPair();
+    auto invalidTx = std::dynamic_pointer_cast<PBTransaction>(
+        fakeTransaction(cryptoSuite, keyPair, "", bytes(), 100, 1000, "chainId", "groupId"));
+    bytes invalidSignature(10, 1);
+    invalidTx->updateSignature(ref(invalidSignature), bytes());
+    block->setTransaction(3, invalidTx);
+    block->encode(*encodedData);
+    BOOST_CHECK_THROW(blockFactory->createBlock(*encodedData, true, true), InvalidTransaction);
+    decodedBlock = blockFactory->createBlock(*encodedData, true, false);
+    Transactions decodedTxs;
+    for (size_t i = 0; i < decodedBlock->transactionsSize(); i++)
+    {
+        decodedTxs.emplace_back(std::const_pointer_cast<Transaction>(decodedBlock->transaction(i)));
+    }
+    auto invalidIndexes = verifyTransactions(cryptoSuite, decodedTxs);
+    BOOST_CHECK(invalidIndexes.size() == 1);
+    BOOST_CHECK(invalidIndexes[0] == 3);
+    BOOST_CHECK(decodedTxs[0]->sender() == txs[0]->sender());
+}
+BOOST_AUTO_TEST_CASE(testIncrementalMerkleRoot)
+{
+    auto cryptoSuite = createNormalCryptoSuite();
+    auto blockFactory = createBlockFactory(cryptoSuite);
+    auto block = std::dynamic_pointer_cast<PBBlock>(blockFactory->createBlock());
+    BOOST_CHECK(block->calculateTransactionRoot() == HashType());
+    BOOST_CHECK(block->calculateReceiptRoot() == HashType());
+    // the merkle tree with more than one level
+    for (size_t i = 0; i < 40; i++)
+    {
+        block->appendTransaction(fakeTransaction(cryptoSuite, utcTime() + i));
+        block->appendReceipt(testPBTransactionReceipt(cryptoSuite));
+    }
+    BOOST_CHECK(block->calculateTransactionRoot() == block->Block::calculateTransactionRoot());
+    BOOST_CHECK(block->calculateReceiptRoot() == block->Block::calculateReceiptRoot());
+
+    // update the cached merkle tree
+    auto txsRoot = block->calculateTransactionRoot();
+    block->setTransaction(17, fakeTransaction(cryptoSuite, utcTime() + 100));
+    block->appendTransaction(fakeTransaction(cryptoSuite, utcTime() + 101));
+    BOOST_CHECK(block->calculateTransactionRoot() != txsRoot);
+    BOOST_CHECK(block->calculateTransactionRoot() == block->Block::calculateTransactionRoot());
+    for (size_t i = 0; i < 260; i++)
+    {
+        block->appendTransaction(fakeTransaction(cryptoSuite, utcTime() + 200 + i));
+    }
+    BOOST_CHECK(block->calculateTransactionRoot() == block->Block::calculateTransactionRoot());
+    // set the transaction beyond the transactions size
+    block->setTransaction(302, fakeTransaction(cryptoSuite, utcTime() + 500));
+    block->setTransaction(301, fakeTransaction(cryptoSuite, utcTime() + 501));
+    BOOST_CHECK(block->calculateTransactionRoot() == block->Block::calculateTransactionRoot());
+
+    auto receipt = blockFactory->receiptFactory()->createReceipt(
+        1000, "", std::make_shared<std::vector<LogEntry>>(), 1, bytes(), 0);
+    block->setReceipt(0, receipt);
+    block->appendReceipt(testPBTransactionReceipt(cryptoSuite));
+    BOOST_CHECK(block->calculateReceiptRoot() == block->Block::calculateReceiptRoot());
+
+    // the merkle proofs of the transactions and receipts
+    txsRoot = block->calculateTransactionRoot();
+    auto txsProof = block->transactionsMerkleProof({0, 17, 302});
+    BOOST_CHECK(txsProof.size() == 3);
+    auto txLeaf = Block::encodeMerkleLeaf(17, block->transaction(17)->hash());
+    BOOST_CHECK(MerkleTree::verifyProof(cryptoSuite, txsRoot, ref(txLeaf), txsProof[1]));
+    BOOST_CHECK(!MerkleTree::verifyProof(cryptoSuite, txsRoot, ref(txLeaf), txsProof[2]));
+    auto receiptsProof = block->receiptsMerkleProof({40});
+    auto receiptLeaf = Block::encodeMerkleLeaf(40, block->receipt(40)->hash());
+    BOOST_CHECK(MerkleTree::verifyProof(
+        cryptoSuite, block->calculateReceiptRoot(), ref(receiptLeaf), receiptsProof[0]));
+
+    // the decoded block
+    auto encodedData = std::make_shared<bytes>();
+    block->encode(*encodedData);
+    auto decodedBlock = blockFactory->createBlock(*encodedData);
+    BOOST_CHECK(decodedBlock->calculateTransactionRoot() == block->calculateTransactionRoot());
+    BOOST_CHECK(decodedBlock->calculateReceiptRoot() == block->calculateReceiptRoot());
+
+    // the block with transactions metaData only
+    auto proposal = std::dynamic_pointer_cast<PBBlock>(blockFactory->createBlock());
+    for (size_t i = 0; i < 20; i++)
+    {
+        auto txMetaData = blockFactory->createTransactionMetaData(
+            block->transaction(i)->hash(), std::string(block->transaction(i)->to()));
+        proposal->appendTransactionMetaData(txMetaData);
+        BOOST_CHECK(
+            proposal->calculateTransactionRoot() == proposal->Block::calculateTransactionRoot());
+    }
+    // the transactions take the place of the transactions metaData
+    proposal->appendTransaction(fakeTransaction(cryptoSuite, utcTime() + 600));
+    BOOST_CHECK(
+        proposal->calculateTransactionRoot() == proposal->Block::calculateTransactionRoot());
+}
+BOOST_AUTO_TEST_CASE(testStreamCodec)
+{
+    auto cryptoSuite = createNormalCryptoSuite();
+    auto blockFactory = createBlockFactory(cryptoSuite);
+    auto block = fakeAndCheckBlock(cryptoSuite, blockFactory, true, 50, 50);
+    block->setNonceList(NonceList{1, 2, 3});
+    block->setVersion(2);
+    bytes encodedData;
+    block->encode(encodedData);
+
+    // the small chunks and batches
+    auto codec = std::make_shared<PBBlockStreamCodec>(blockFactory, 64, 7);
+    bytes streamData;
+    size_t chunksNum = 0;
+    codec->encode(block, [&](bytesConstRef _chunk) {
+        streamData.insert(streamData.end(), _chunk.begin(), _chunk.end());
+        chunksNum++;
+    });
+    BOOST_CHECK(streamData == encodedData);
+    BOOST_CHECK(chunksNum > 1);
+
+    size_t offset = 0;
+    auto source = [&](byte* _buffer, size_t _size) {
+        auto size = std::min(_size, streamData.size() - offset);
+        memcpy(_buffer, streamData.data() + offset, size);
+        offset += size;
+        return size;
+    };
+    auto decodedBlock = codec->decode(source);
+    checkBlock(cryptoSuite, block, decodedBlock);
+    BOOST_CHECK(decodedBlock->version() == 2);
+    BOOST_CHECK(decodedBlock->nonceList() == block->nonceList());
+    bytes reencodedData;
+    decodedBlock->encode(reencodedData);
+    BOOST_CHECK(reencodedData == encodedData);
+
+    // encode the decoded block with the raw transactions
+    auto pbBlockFactory = std::dynamic_pointer_cast<PBBlockFactory>(blockFactory);
+    pbBlockFactory->setLazyDecodeTransactions(true);
+    decodedBlock = blockFactory->createBlock(encodedData);
+    streamData.clear();
+    codec = std::make_shared<PBBlockStreamCodec>(blockFactory);
+    codec->encode(decodedBlock, [&](bytesConstRef _chunk) {
+        streamData.insert(streamData.end(), _chunk.begin(), _chunk.end());
+    });
+    BOOST_CHECK(streamData == encodedData);
+
+    // the truncated data
+    streamData.resize(streamData.size() - 10);
+    offset = 0;
+    BOOST_CHECK_THROW(codec->decode(source), PBObjectDecodeException);
+}
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace bcos
\ No newline at end of file
@@ -101,6 +101,65 @@ void testBlock(CryptoSuite::Ptr cryptoSuite)
         std::make_shared<PBTransaction>(cryptoSuite, buffer, true), PBObjectDecodeException);
 }
 
+BOOST_AUTO_TEST_CASE(testDecodeWithoutCopy)
+{
+    auto hashImpl = std::make_shared<Keccak256Hash>();
+    auto signatureImpl = std::make_shared<Secp256k1SignatureImpl>();
+    auto cryptoSuite = std::make_shared<CryptoSuite>(hashImpl, signatureImpl, nullptr);
+    std::string to = "5fe3c4c3e2079879a0dba1937aca95ac16e68f0f";
+    bytes input(1024, 'a');
+    PBTransaction tx(cryptoSuite, 100, to, input, u256(10086), 1000, "testChain", "testGroup", 888);
+    auto keyPair = cryptoSuite->signatureImpl()->generateKeyPair();
+    auto sign = cryptoSuite->signatureImpl()->sign(keyPair, tx.hash());
+    tx.updateSignature(bcos::ref(*sign), keyPair->publicKey()->data());
+    tx.setAttribute(3);
+    tx.setSource("source");
+
+    auto txData = std::make_shared<bytes>(tx.encode(false).toBytes());
+    auto decodedTx = std::make_shared<PBTransaction>(cryptoSuite, ref(*txData), txData, true);
+    // the fields refer to the borrowed data
+    auto begin = txData->data();
+    auto end = txData->data() + txData->size();
+    BOOST_CHECK(decodedTx->input().data() >= begin && decodedTx->input().data() < end);
+    BOOST_CHECK((byte const*)decodedTx->to().data() >= begin);
+    BOOST_CHECK(decodedTx->signatureData().data() >= begin);
+    BOOST_CHECK(decodedTx->encode(false).data() == begin);
+    BOOST_CHECK(decodedTx->input().toBytes() == input);
+    BOOST_CHECK_EQUAL(decodedTx->to(), to);
+    BOOST_CHECK_EQUAL(decodedTx->version(), 100);
+    BOOST_CHECK_EQUAL(decodedTx->blockLimit(), 1000);
+    BOOST_CHECK_EQUAL(decodedTx->chainId(), "testChain");
+    BOOST_CHECK_EQUAL(decodedTx->groupId(), "testGroup");
+    BOOST_CHECK_EQUAL(decodedTx->importTime(), 888);
+    BOOST_CHECK_EQUAL(decodedTx->attribute(), 3);
+    BOOST_CHECK_EQUAL(decodedTx->source(), "source");
+    BOOST_CHECK(decodedTx->nonce() == u256(10086));
+    BOOST_CHECK(decodedTx->hash() == tx.hash());
+    auto sender = cryptoSuite->calculateAddress(keyPair->publicKey()).asBytes();
+    BOOST_CHECK(decodedTx->sender() == std::string_view((char*)sender.data(), sender.size()));
+
+    // the transaction keeps the borrowed data alive
+    std::weak_ptr<bytes> weakTxData = txData;
+    txData.reset();
+    BOOST_CHECK(!weakTxData.expired());
+    // the modification copies the borrowed data
+    decodedTx->setImportTime(999);
+    BOOST_CHECK(weakTxData.expired());
+    BOOST_CHECK_EQUAL(decodedTx->importTime(), 999);
+    BOOST_CHECK(decodedTx->input().toBytes() == input);
+    BOOST_CHECK_EQUAL(decodedTx->source(), "source");
+    BOOST_CHECK(decodedTx->hash() == tx.hash());
+    auto reDecodedTx = std::make_shared<PBTransaction>(cryptoSuite, decodedTx->encode(false), true);
+    BOOST_CHECK_EQUAL(reDecodedTx->importTime(), 999);
+    BOOST_CHECK(reDecodedTx->hash() == tx.hash());
+
+    // invalid data
+    bytes invalidData = tx.encode(false).toBytes();
+    invalidData.resize(invalidData.size() / 2);
+    BOOST_CHECK_THROW(std::make_shared<PBTransaction>(cryptoSuite, invalidData, false),
+        PBObjectDecodeException);
+}
+
 BOOST_AUTO_TEST_CASE(testTransactionWithRawData)
 {
     auto hashImpl = std::make_shared<Keccak256Hash>();
@@ -19,6 +19,10 @@
 #include "libutilities/Base64.h"
 #include "../../../testutils/TestPromptFixture.h"
 #include "libutilities/DataConvertUtility.h"
+#include "libutilities/Exceptions.h"
+#include <boost/archive/iterators/base64_from_binary.hpp>
+#include <boost/archive/iterators/binary_from_base64.hpp>
+#include <boost/archive/iterators/transform_width.hpp>
 #include <boost/test/unit_test.hpp>
 #include <iostream>
 #include <string>
@@ -93,6 +97,119 @@ BOOST_AUTO_TEST_CASE(testBase64CodecZero)
     BOOST_CHECK_EQUAL(ov.size(), 100);
 }
 
+BOOST_AUTO_TEST_CASE(testBase64Vectors)
+{
+    // the test vectors of RFC 4648
+    std::vector<std::pair<std::string, std::string>> vectors = {{"", ""}, {"f", "Zg=="},
+        {"fo", "Zm8="}, {"foo", "Zm9v"}, {"foob", "Zm9vYg=="}, {"fooba", "Zm9vYmE="},
+        {"foobar", "Zm9vYmFy"}};
+    for (auto const& [data, base64] : vectors)
+    {
+        BOOST_CHECK_EQUAL(base64Encode(data), base64);
+        BOOST_CHECK_EQUAL(base64Decode(base64), data);
+        BOOST_CHECK_EQUAL(base64DecodedSize(base64), data.size());
+    }
+    std::string all;
+    for (int i = 0; i < 256; i++)
+    {
+        all.push_back((char)i);
+    }
+    for (size_t size = 0; size <= all.size(); size++)
+    {
+        auto data = all.substr(all.size() - size);
+        // the boost iterators as the reference implementation
+        using It = boost::archive::iterators::base64_from_binary<
+            boost::archive::iterators::transform_width<std::string::const_iterator, 6, 8>>;
+        auto expected = std::string(It(data.begin()), It(data.end()));
+        expected.append((3 - size % 3) % 3, '=');
+
+        std::string base64(base64EncodedSize(size), '\0');
+        BOOST_CHECK_EQUAL(base64EncodeInto(bytesConstRef((byte const*)data.data(), size),
+                              base64.data()),
+            base64.size());
+        BOOST_CHECK_EQUAL(base64, expected);
+        bytes decoded(base64DecodedSize(base64));
+        BOOST_CHECK_EQUAL(base64DecodeInto(base64, decoded.data()), size);
+        BOOST_CHECK(std::string(decoded.begin(), decoded.end()) == data);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testBase64Invalid)
+{
+    // the invalid size
+    BOOST_CHECK_THROW(base64Decode("Zm9"), BadBase64Data);
+    BOOST_CHECK_THROW(base64Decode("Zm9vY"), BadBase64Data);
+    // the invalid chars
+    BOOST_CHECK_THROW(base64Decode("Zm9-"), BadBase64Data);
+    BOOST_CHECK_THROW(base64Decode("Zm9v Zm9v"), BadBase64Data);
+    BOOST_CHECK_THROW(base64Decode("Zm\x80v"), BadBase64Data);
+    BOOST_CHECK_THROW(base64Decode(std::string("Zm9v\0m9v", 8)), BadBase64Data);
+    // the misplaced padding
+    BOOST_CHECK_THROW(base64Decode("===="), BadBase64Data);
+    BOOST_CHECK_THROW(base64Decode("Z==="), BadBase64Data);
+    BOOST_CHECK_THROW(base64Decode("Zg==Zm9v"), BadBase64Data);
+    BOOST_CHECK_THROW(base64Decode("Z=9v"), BadBase64Data);
+    // the non-zero padding bits
+    BOOST_CHECK_THROW(base64Decode("Zh=="), BadBase64Data);
+    BOOST_CHECK_THROW(base64Decode("Zm9="), BadBase64Data);
+    BOOST_CHECK_THROW(base64DecodeBytes("Zm9vYh=="), BadBase64Data);
+    BOOST_CHECK(base64Decode("Zm8=") == "fo");
+}
+
+BOOST_AUTO_TEST_CASE(testBase64Perf)
+{
+    size_t size = 1024 * 1024;
+    size_t round = 20;
+    std::string data(size, '\0');
+    for (size_t i = 0; i < size; i++)
+    {
+        data[i] = (char)(i * 131 + i / 7);
+    }
+    using EncodeIt = boost::archive::iterators::base64_from_binary<
+        boost::archive::iterators::transform_width<std::string::const_iterator, 6, 8>>;
+    using DecodeIt = boost::archive::iterators::transform_width<
+        boost::archive::iterators::binary_from_base64<std::string::const_iterator>, 8, 6>;
+
+    // the boost iterators
+    auto startT = utcSteadyTime();
+    std::string expected;
+    for (size_t i = 0; i < round; i++)
+    {
+        expected = std::string(EncodeIt(data.begin()), EncodeIt(data.end()));
+        expected.append((3 - size % 3) % 3, '=');
+    }
+    std::cout << "#### boost base64 encode " << round << " * 1MB, cost: "
+              << utcSteadyTime() - startT << "ms" << std::endl;
+    startT = utcSteadyTime();
+    for (size_t i = 0; i < round; i++)
+    {
+        auto decoded = std::string(DecodeIt(expected.begin()), DecodeIt(expected.end()));
+        BOOST_CHECK(decoded.size() >= size);
+    }
+    std::cout << "#### boost base64 decode " << round << " * 1MB, cost: "
+              << utcSteadyTime() - startT << "ms" << std::endl;
+
+    // the table-driven codec
+    startT = utcSteadyTime();
+    std::string base64;
+    for (size_t i = 0; i < round; i++)
+    {
+        base64 = base64Encode(data);
+    }
+    std::cout << "#### base64Encode " << round << " * 1MB, cost: " << utcSteadyTime() - startT
+              << "ms" << std::endl;
+    BOOST_CHECK(base64 == expected);
+    startT = utcSteadyTime();
+    std::string decoded;
+    for (size_t i = 0; i < round; i++)
+    {
+        decoded = base64Decode(base64);
+    }
+    std::cout << "#### base64Decode " << round << " * 1MB, cost: " << utcSteadyTime() - startT
+              << "ms" << std::endl;
+    BOOST_CHECK(decoded == data);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace bcos
@@ -0,0 +1,71 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief Unit tests for the BytesPool
+ * @file BytesPoolTest.cpp
+ * @author: yujiechen
+ * @date 2021-10-18
+ */
+#include "libutilities/BytesPool.h"
+#include "../../../testutils/TestPromptFixture.h"
+#include <boost/test/unit_test.hpp>
+
+using namespace bcos;
+namespace bcos
+{
+namespace test
+{
+BOOST_FIXTURE_TEST_SUITE(BytesPoolTest, TestPromptFixture)
+BOOST_AUTO_TEST_CASE(testBufferReuse)
+{
+    auto pool = std::make_shared<BytesPool>(2, 1024);
+    auto buffer = pool->allocate();
+    buffer->resize(512);
+    auto bufferAddr = buffer->data();
+    BOOST_CHECK(pool->pooledBuffers() == 0);
+    buffer.reset();
+    BOOST_CHECK(pool->pooledBuffers() == 1);
+
+    // the recycled buffer is cleared with the capacity retained
+    auto reusedBuffer = pool->allocate();
+    BOOST_CHECK(pool->pooledBuffers() == 0);
+    BOOST_CHECK(reusedBuffer->empty());
+    BOOST_CHECK(reusedBuffer->capacity() >= 512);
+    reusedBuffer->resize(10);
+    BOOST_CHECK(reusedBuffer->data() == bufferAddr);
+
+    // the over-sized buffer will not be recycled
+    reusedBuffer->resize(2048);
+    reusedBuffer.reset();
+    BOOST_CHECK(pool->pooledBuffers() == 0);
+
+    // at most 2 buffers are pooled
+    std::vector<bytesPointer> buffers;
+    for (size_t i = 0; i < 4; i++)
+    {
+        buffers.emplace_back(pool->allocate());
+    }
+    buffers.clear();
+    BOOST_CHECK(pool->pooledBuffers() == 2);
+
+    // the buffer outlives the pool
+    auto orphanBuffer = pool->allocate();
+    pool.reset();
+    orphanBuffer->resize(100);
+    orphanBuffer.reset();
+}
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace bcos
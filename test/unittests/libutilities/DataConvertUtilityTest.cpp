@@ -20,11 +20,14 @@
  */
 #include "libutilities/DataConvertUtility.h"
 #include "libutilities/Exceptions.h"
+#include "libutilities/FixedBytes.h"
 #include "../../../testutils/TestPromptFixture.h"
+#include <boost/algorithm/string.hpp>
 #include <boost/test/unit_test.hpp>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
+#include <random>
 
 using namespace bcos;
 namespace bcos
@@ -63,6 +66,111 @@ BOOST_AUTO_TEST_CASE(testHex)
 }
 
 /// test asString && asBytes
+/// test the vectorized hex kernels against the byte-wise boost implementation
+BOOST_AUTO_TEST_CASE(testHexKernels)
+{
+    std::mt19937 engine(12345);
+    for (size_t size = 0; size < 200; size++)
+    {
+        bytes data(size);
+        for (auto& item : data)
+        {
+            item = (byte)engine();
+        }
+        std::string expected;
+        boost::algorithm::hex_lower(data.begin(), data.end(), std::back_inserter(expected));
+        BOOST_CHECK_EQUAL(toHex(data), expected);
+        BOOST_CHECK_EQUAL(*toHexString(data), expected);
+        BOOST_CHECK_EQUAL(toHexStringWithPrefix(data), "0x" + expected);
+        BOOST_CHECK_EQUAL(toHex(data, "0x"), "0x" + expected);
+
+        std::string hex(size * 2, '\0');
+        BOOST_CHECK_EQUAL(toHexInto(data, hex.data()), size * 2);
+        BOOST_CHECK_EQUAL(hex, expected);
+        if (size == 0)
+        {
+            continue;
+        }
+        BOOST_CHECK(fromHex(expected) == data);
+        BOOST_CHECK(fromHex("0x" + expected, "0x") == data);
+        BOOST_CHECK(*fromHexString(expected) == data);
+        bytes decoded(size);
+        BOOST_CHECK_EQUAL(fromHexInto(expected, decoded.data()), size);
+        BOOST_CHECK(decoded == data);
+        // the upper case hex chars
+        BOOST_CHECK(fromHex(boost::algorithm::to_upper_copy(expected)) == data);
+
+        // the invalid char at any position
+        auto position = engine() % expected.size();
+        for (auto invalid : {'g', 'G', '/', ':', '@', '`', ' ', '\x80', '\xff'})
+        {
+            auto invalidHex = expected;
+            invalidHex[position] = invalid;
+            BOOST_CHECK_THROW(fromHex(invalidHex), bcos::Error);
+            BOOST_CHECK_THROW(fromHexString(invalidHex), BadHexCharacter);
+            BOOST_CHECK(!hexDecode(invalidHex.data(), invalidHex.size(), decoded.data()));
+        }
+    }
+    BOOST_CHECK_THROW(fromHexInto(std::string("abc"), nullptr), bcos::Error);
+    BOOST_CHECK(toHex(std::string("\x01\xab")) == "01ab");
+    BOOST_CHECK(FixedBytes<32>(std::string(64, 'A')).hex() == std::string(64, 'a'));
+}
+
+BOOST_AUTO_TEST_CASE(testHexPerf)
+{
+    size_t size = 64 * 1024 * 1024;
+    bytes data(size);
+    std::mt19937 engine(12345);
+    for (auto& item : data)
+    {
+        item = (byte)engine();
+    }
+    // the byte-wise boost implementation
+    auto startT = utcSteadyTime();
+    std::string expected;
+    expected.reserve(size * 2);
+    boost::algorithm::hex_lower(data.begin(), data.end(), std::back_inserter(expected));
+    auto cost = std::max<int64_t>(utcSteadyTime() - startT, 1);
+    std::cout << "#### boost hex_lower " << size / 1024 / 1024 << "MB, cost: " << cost
+              << "ms, throughput: " << size / 1024 / 1024 * 1000 / cost << "MB/s" << std::endl;
+    startT = utcSteadyTime();
+    bytes expectedData;
+    expectedData.reserve(size);
+    boost::algorithm::unhex(expected.begin(), expected.end(), std::back_inserter(expectedData));
+    cost = std::max<int64_t>(utcSteadyTime() - startT, 1);
+    std::cout << "#### boost unhex " << size / 1024 / 1024 << "MB, cost: " << cost
+              << "ms, throughput: " << size / 1024 / 1024 * 1000 / cost << "MB/s" << std::endl;
+
+    // the vectorized kernels
+    std::string hex(size * 2, '\0');
+    startT = utcSteadyTime();
+    toHexInto(data, hex.data());
+    cost = std::max<int64_t>(utcSteadyTime() - startT, 1);
+    std::cout << "#### toHexInto " << size / 1024 / 1024 << "MB, cost: " << cost
+              << "ms, throughput: " << size / 1024 / 1024 * 1000 / cost << "MB/s" << std::endl;
+    BOOST_CHECK(hex == expected);
+    bytes decoded(size);
+    startT = utcSteadyTime();
+    fromHexInto(hex, decoded.data());
+    cost = std::max<int64_t>(utcSteadyTime() - startT, 1);
+    std::cout << "#### fromHexInto " << size / 1024 / 1024 << "MB, cost: " << cost
+              << "ms, throughput: " << size / 1024 / 1024 * 1000 / cost << "MB/s" << std::endl;
+    BOOST_CHECK(decoded == data);
+
+    // the hex of the hashes
+    size_t count = 1000000;
+    h256 hash(bytesConstRef(data.data(), h256::size));
+    startT = utcSteadyTime();
+    size_t hexSize = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        hexSize += hash.hex().size();
+    }
+    std::cout << "#### h256::hex " << count << " times, cost: " << utcSteadyTime() - startT
+              << "ms" << std::endl;
+    BOOST_CHECK_EQUAL(hexSize, count * 64);
+}
+
 BOOST_AUTO_TEST_CASE(testStringTrans)
 {
     std::string tmp_str = "abcdef012343";
@@ -96,6 +204,107 @@ BOOST_AUTO_TEST_CASE(testBigEndian)
     BOOST_CHECK(fromBigEndian<u256>(big_endian_bytes) == number);
     BOOST_CHECK(fromBigEndian<u160>(toBigEndian(number_u160)) == number_u160);
 }
+/// test the limb-wise u256 conversion against the generic byte-wise conversion
+BOOST_AUTO_TEST_CASE(testU256BigEndian)
+{
+    std::vector<u256> values = {0, 1, 0xff, u256(1) << 64, (u256(1) << 255) + 0x1234,
+        u256("9832989324908234742342343243243234324324243432432234324"), ~u256(0)};
+    for (auto const& value : values)
+    {
+        bytes expected(32, 0);
+        auto v = value;
+        for (size_t i = 32; i != 0; v >>= 8, i--)
+        {
+            expected[i - 1] = (byte)(v & 0xff);
+        }
+        std::array<byte, 32> output;
+        u256ToBigEndian(value, output.data());
+        BOOST_CHECK(bytes(output.begin(), output.end()) == expected);
+        BOOST_CHECK(toBigEndian(value) == expected);
+        BOOST_CHECK(u256FromBigEndian(expected.data(), expected.size()) == value);
+        BOOST_CHECK(fromBigEndian<u256>(ref(expected)) == value);
+        BOOST_CHECK(fromBigEndian<u256>(asString(expected)) == value);
+        BOOST_CHECK(FixedBytes<32>(value) == FixedBytes<32>(expected));
+        BOOST_CHECK((u256)FixedBytes<32>(expected) == value);
+
+        // the larger output is zero-padded
+        bytes padded(40, 0xff);
+        toBigEndian(value, padded);
+        BOOST_CHECK(bytes(padded.begin(), padded.begin() + 8) == bytes(8, 0));
+        BOOST_CHECK(bytes(padded.begin() + 8, padded.end()) == expected);
+        // the longer input is truncated to the lowest 32 bytes
+        BOOST_CHECK(fromBigEndian<u256>(padded) == value);
+    }
+    // the short input
+    bytes shortData = {0x01, 0x02, 0x03};
+    BOOST_CHECK(fromBigEndian<u256>(shortData) == 0x010203);
+    BOOST_CHECK(u256FromBigEndian(shortData.data(), 0) == 0);
+
+    // the batch conversion
+    bytes data(values.size() * 32);
+    u256sToBigEndian(values, data.data());
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        BOOST_CHECK(bytes(data.begin() + i * 32, data.begin() + (i + 1) * 32) ==
+                    toBigEndian(values[i]));
+    }
+    BOOST_CHECK(u256sFromBigEndian(ref(data)) == values);
+    BOOST_CHECK_THROW(u256sFromBigEndian(bytesConstRef(data.data(), 31)), bcos::Error);
+}
+
+BOOST_AUTO_TEST_CASE(testU256BigEndianPerf)
+{
+    size_t count = 1000000;
+    std::vector<u256> nonces;
+    nonces.reserve(count);
+    u256 nonce("9832989324908234742342343243243234324324243432432234324");
+    for (size_t i = 0; i < count; i++)
+    {
+        nonces.emplace_back(nonce + i);
+    }
+    bytes data(count * 32);
+
+    // the generic byte-wise conversion
+    auto startT = utcSteadyTime();
+    for (size_t i = 0; i < count; i++)
+    {
+        auto v = nonces[i];
+        for (size_t j = 32; j != 0; v >>= 8, j--)
+        {
+            data[i * 32 + j - 1] = (byte)(v & 0xff);
+        }
+    }
+    std::cout << "#### byte-wise toBigEndian " << count << " u256, cost: "
+              << utcSteadyTime() - startT << "ms" << std::endl;
+    startT = utcSteadyTime();
+    u256 sum = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        u256 value = 0;
+        for (size_t j = 0; j < 32; j++)
+        {
+            value = (value << 8) | data[i * 32 + j];
+        }
+        sum += value;
+    }
+    std::cout << "#### byte-wise fromBigEndian " << count << " u256, cost: "
+              << utcSteadyTime() - startT << "ms" << std::endl;
+
+    // the limb-wise conversion
+    bytes fastData(count * 32);
+    startT = utcSteadyTime();
+    u256sToBigEndian(nonces, fastData.data());
+    std::cout << "#### limb-wise toBigEndian " << count << " u256, cost: "
+              << utcSteadyTime() - startT << "ms" << std::endl;
+    BOOST_CHECK(fastData == data);
+    startT = utcSteadyTime();
+    auto decodedNonces = u256sFromBigEndian(ref(fastData));
+    std::cout << "#### limb-wise fromBigEndian " << count << " u256, cost: "
+              << utcSteadyTime() - startT << "ms" << std::endl;
+    BOOST_CHECK(decodedNonces == nonces);
+    BOOST_CHECK(sum != 0);
+}
+
 /// test operator+
 BOOST_AUTO_TEST_CASE(testOperators)
 {
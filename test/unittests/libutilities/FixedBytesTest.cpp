@@ -0,0 +1,162 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief Unit tests for the FixedBytes
+ * @file FixedBytesTest.cpp
+ * @author: yujiechen
+ * @date: 2021-10-18
+ */
+#include "libutilities/FixedBytes.h"
+#include "../../../testutils/TestPromptFixture.h"
+#include <boost/test/unit_test.hpp>
+#include <iostream>
+#include <set>
+#include <unordered_set>
+
+using namespace bcos;
+namespace bcos
+{
+namespace test
+{
+BOOST_FIXTURE_TEST_SUITE(FixedBytesTest, TestPromptFixture)
+
+// check the word-wide operators against the byte-wise ones
+template <unsigned N>
+void checkOperators()
+{
+    std::mt19937 engine(N);
+    for (size_t i = 0; i < 1000; i++)
+    {
+        FixedBytes<N> left;
+        left.generateRandomFixedBytesByEngine(engine);
+        auto right = left;
+        // differ in one byte, or in all the bytes
+        if (i % 2 == 0)
+        {
+            right[engine() % N] ^= (byte)(engine() % 255 + 1);
+        }
+        else if (i % 4 == 1)
+        {
+            right.generateRandomFixedBytesByEngine(engine);
+        }
+        auto leftBytes = left.asBytes();
+        auto rightBytes = right.asBytes();
+        BOOST_CHECK_EQUAL(left == right, leftBytes == rightBytes);
+        BOOST_CHECK_EQUAL(left != right, leftBytes != rightBytes);
+        BOOST_CHECK_EQUAL(left < right, leftBytes < rightBytes);
+        BOOST_CHECK_EQUAL(left > right, leftBytes > rightBytes);
+        BOOST_CHECK_EQUAL(left <= right, leftBytes <= rightBytes);
+        BOOST_CHECK_EQUAL(left >= right, leftBytes >= rightBytes);
+        if (left == right)
+        {
+            BOOST_CHECK_EQUAL(
+                typename FixedBytes<N>::hash()(left), typename FixedBytes<N>::hash()(right));
+        }
+
+        bytes xorBytes(N);
+        bytes orBytes(N);
+        bytes andBytes(N);
+        for (unsigned j = 0; j < N; j++)
+        {
+            xorBytes[j] = leftBytes[j] ^ rightBytes[j];
+            orBytes[j] = leftBytes[j] | rightBytes[j];
+            andBytes[j] = leftBytes[j] & rightBytes[j];
+        }
+        BOOST_CHECK((left ^ right).asBytes() == xorBytes);
+        BOOST_CHECK((left | right).asBytes() == orBytes);
+        BOOST_CHECK((left & right).asBytes() == andBytes);
+        BOOST_CHECK(((left ^ right) ^ right) == left);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testOperators)
+{
+    checkOperators<8>();
+    checkOperators<20>();
+    checkOperators<32>();
+    checkOperators<64>();
+    checkOperators<65>();
+
+    // the secure fixed bytes
+    SecureFixedBytes<32> left(h256(0x0f0f));
+    SecureFixedBytes<32> right(h256(0x00ff));
+    BOOST_CHECK((left | right).makeInsecure() == h256(0x0fff));
+    BOOST_CHECK((left & right).makeInsecure() == h256(0x000f));
+    BOOST_CHECK((left ^ right).makeInsecure() == h256(0x0ff0));
+}
+
+BOOST_AUTO_TEST_CASE(testHash)
+{
+    // the numbers and the short right-aligned data
+    std::unordered_set<size_t> hashes;
+    std::unordered_set<size_t> addressHashes;
+    for (size_t i = 0; i < 10000; i++)
+    {
+        hashes.insert(h256::hash()(h256(i)));
+        addressHashes.insert(h160::hash()(h160(i)));
+    }
+    BOOST_CHECK_EQUAL(hashes.size(), 10000);
+    BOOST_CHECK_EQUAL(addressHashes.size(), 10000);
+    BOOST_CHECK_EQUAL(std::hash<h256>()(h256(1)), h256::hash()(h256(1)));
+}
+
+BOOST_AUTO_TEST_CASE(testFixedBytesPerf)
+{
+    size_t count = 1000000;
+    std::mt19937 engine(count);
+    std::vector<h256> hashList(count);
+    for (auto& hash : hashList)
+    {
+        hash.generateRandomFixedBytesByEngine(engine);
+    }
+    auto startT = utcSteadyTime();
+    std::unordered_set<h256> hashSet(hashList.begin(), hashList.end());
+    std::cout << "#### insert " << count << " h256 into unordered_set, cost: "
+              << utcSteadyTime() - startT << "ms" << std::endl;
+    startT = utcSteadyTime();
+    size_t found = 0;
+    for (size_t round = 0; round < 5; round++)
+    {
+        for (auto const& hash : hashList)
+        {
+            found += hashSet.count(hash);
+        }
+    }
+    std::cout << "#### find " << count * 5 << " h256 in unordered_set, cost: "
+              << utcSteadyTime() - startT << "ms" << std::endl;
+    BOOST_CHECK_EQUAL(found, count * 5);
+
+    startT = utcSteadyTime();
+    std::set<h256> sortedSet(hashList.begin(), hashList.end());
+    std::cout << "#### insert " << count << " h256 into set, cost: " << utcSteadyTime() - startT
+              << "ms" << std::endl;
+    BOOST_CHECK_EQUAL(sortedSet.size(), count);
+
+    startT = utcSteadyTime();
+    h256 totalHash;
+    for (size_t round = 0; round < 10; round++)
+    {
+        for (auto const& hash : hashList)
+        {
+            totalHash ^= hash;
+        }
+    }
+    std::cout << "#### xor " << count * 10 << " h256, cost: " << utcSteadyTime() - startT << "ms"
+              << std::endl;
+    BOOST_CHECK(totalHash == h256());
+}
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace bcos